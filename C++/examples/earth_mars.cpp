@@ -40,18 +40,20 @@
  *
  * CRITICAL SIMPLIFICATIONS:
  * -------------------------
- * This calculation does NOT include:
- *   1. Escaping Earth's gravity (requires ~3.6 km/s from LEO)
- *   2. Entering Mars orbit (requires ~2.1 km/s)
+ * The heliocentric transfer alone does NOT include:
+ *   1. Escaping Earth's gravity from a parking orbit
+ *   2. Being captured into orbit around Mars
  *   3. Elliptical actual orbits (eccentricity ~0.017 Earth, ~0.093 Mars)
  *   4. Orbital inclinations (Mars is tilted 1.85 deg to ecliptic)
  *   5. Gravity assists from other planets
  *
- * For a COMPLETE Mars mission delta-v budget, you need:
- *   - LEO to Earth escape: ~3.6 km/s
- *   - Heliocentric transfer: ~2.9 km/s (this calculation)
- *   - Mars orbit insertion: ~2.1 km/s
- *   - Mars landing: ~4.1 km/s (most done by atmosphere)
+ * Items 1 and 2 are computed at the end of this example with the
+ * patched-conic engine (PatchedConicMission): the heliocentric dv1/dv2 become
+ * hyperbolic excess speeds at Earth and Mars, and the burns happen at the
+ * periapsis of the departure/arrival hyperbolas. From a 400 km LEO into a
+ * 400 km Mars orbit that is ~3.6 km/s + ~2.1 km/s.
+ *
+ * Mars landing (~4.1 km/s, mostly shed by the atmosphere) is not modeled.
  *
  * ==============================================================================
  * AEROSPACE CONCEPT: Launch Windows and Phase Angles
@@ -101,10 +103,12 @@
 #include "hohmann/celestial_body.hpp"
 #include "hohmann/orbit.hpp"
 #include "hohmann/hohmann_transfer.hpp"
+#include "hohmann/patched_conic.hpp"
 #include "hohmann/constants.hpp"
 
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 using namespace hohmann;
 
@@ -237,7 +241,7 @@ int main() {
     //   1. Escape Earth's gravity well (~11.2 km/s escape velocity)
     //   2. But we get credit for Earth's orbital velocity (~29.8 km/s)
     //
-    // The actual LEO departure burn is ~3.6 km/s
+    // The actual LEO departure burn is computed in the mission budget below
     // -------------------------------------------------------------------------
     std::cout << std::setprecision(2);
     std::cout << "  BURN 1 (at Earth's orbit):\n";
@@ -319,23 +323,67 @@ int main() {
     //
     // FROM EARTH:
     //   LEO insertion:     ~9.4 km/s  (from Earth's surface)
-    //   Trans-Mars injection: ~3.6 km/s (from LEO)
+    //   Trans-Mars injection: computed below (from the parking orbit)
     //
     // HELIOCENTRIC (this calculation):
     //   Transfer dv: ~2.9 km/s (already accounted for in TMI)
     //
     // AT MARS:
-    //   Mars orbit insertion: ~2.1 km/s (to enter Mars orbit)
+    //   Mars orbit insertion: computed below (depends on the capture orbit)
     //   Landing: ~4.1 km/s (mostly aerobraking if atmosphere used)
     //
     // TOTAL (Earth surface to Mars surface): ~11-16 km/s
     // This is why Mars missions are so challenging!
+    //
+    // PATCHED CONICS:
+    // The heliocentric dv1 and dv2 are the hyperbolic excess speeds (v_inf)
+    // relative to Earth and Mars. PatchedConicMission turns them into the
+    // actual periapsis burns for any parking/capture orbit. deltaVTable()
+    // evaluates every (parking altitude, capture orbit) pair in one call.
     // =========================================================================
+    auto earth = CelestialBody::Earth();
+    auto mars = CelestialBody::Mars();
+    PatchedConicMission mission(transfer, earth, mars);
+
+    double tmi_dv = mission.departureDeltaV(Orbit::LEO(earth));
+    double moi_dv = mission.captureDeltaV(Orbit::fromAltitude(mars, 400e3));
+
+    std::cout << "=== Mission Budget (Patched Conics) ===\n";
+    std::cout << std::setprecision(2);
+    std::cout << "  v_inf at Earth: " << mission.departureVInfinity() / 1000.0 << " km/s\n";
+    std::cout << "  v_inf at Mars:  " << mission.arrivalVInfinity() / 1000.0 << " km/s\n";
+    std::cout << "  Earth departure burn (400 km LEO):     " << tmi_dv / 1000.0 << " km/s\n";
+    std::cout << "  Mars orbit insertion (400 km circular): " << moi_dv / 1000.0 << " km/s\n\n";
+
+    // Parking altitudes x capture orbits: a low circular science orbit and a
+    // loose 400 x 33,000 km ellipse (much cheaper; aerobrake down later)
+    std::vector<double> parking_radii = {
+        bodyRadius::earth + 200e3, bodyRadius::earth + 400e3, bodyRadius::earth + 1000e3
+    };
+    double loose_rp = bodyRadius::mars + 400e3;
+    double loose_ra = bodyRadius::mars + 33000e3;
+    std::vector<CaptureOrbit> capture_orbits = {
+        {bodyRadius::mars + 400e3, 0.0},
+        {loose_rp, (loose_ra - loose_rp) / (loose_ra + loose_rp)}
+    };
+    auto table = mission.deltaVTable(parking_radii, capture_orbits);
+
+    std::cout << "  Total departure + capture dv [km/s]:\n";
+    std::cout << "    Parking alt   400 km circ   400x33000 km\n";
+    for (std::size_t i = 0; i < table.parkingCount(); ++i) {
+        std::cout << "    " << std::setw(6) << std::setprecision(0)
+                  << (table.parkingRadius[i] - bodyRadius::earth) / 1000.0 << " km"
+                  << std::setprecision(2);
+        for (std::size_t j = 0; j < table.captureCount(); ++j) {
+            std::cout << std::setw(14) << table.total(i, j) / 1000.0;
+        }
+        std::cout << "\n";
+    }
+    std::cout << "\n";
+
     std::cout << "=== Important Notes ===\n";
-    std::cout << "  This is a SIMPLIFIED heliocentric calculation.\n\n";
-    std::cout << "  A real Mars mission also needs:\n";
-    std::cout << "  - Earth departure burn: ~3.6 km/s from LEO\n";
-    std::cout << "  - Mars orbit insertion: ~2.1 km/s\n";
+    std::cout << "  Heliocentric orbits are treated as circular and coplanar.\n\n";
+    std::cout << "  Not included above:\n";
     std::cout << "  - Mars landing (if applicable): ~4.1 km/s\n\n";
     std::cout << "  Launch windows occur every ~26 months when\n";
     std::cout << "  Earth and Mars are properly aligned.\n";
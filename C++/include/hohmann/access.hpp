@@ -0,0 +1,124 @@
+#ifndef HOHMANN_ACCESS_HPP
+#define HOHMANN_ACCESS_HPP
+
+/*
+ * access.hpp - Ground tracks and satellite / ground-station access windows
+ */
+
+#include "orbital_elements.hpp"
+#include "scheduler.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * Greenwich sidereal angle at an epoch (seconds past J2000) [rad, 0..2pi)
+ *
+ * Earth rotation at a constant rate from its J2000 value; UT1 - TT and
+ * precession are neglected, which is a few arcseconds per year.
+ */
+[[nodiscard]] double siderealAngle(double epoch);
+
+/*
+ * GroundStation struct - Site on a spherical Earth (bodyRadius::earth)
+ */
+struct GroundStation {
+    double latitude;            ///< [rad]
+    double longitude;           ///< East [rad]
+    double altitude = 0.0;      ///< Above the mean radius [m]
+    double minElevation = 0.0;  ///< Elevation mask [rad]
+};
+
+/*
+ * GroundTrackColumns struct - Sub-satellite points, one per sample
+ */
+struct GroundTrackColumns {
+    std::vector<double> time;        ///< Seconds past J2000
+    std::vector<double> latitude;    ///< Geocentric [rad]
+    std::vector<double> longitude;   ///< East, in (-pi, pi] [rad]
+    std::vector<double> altitude;    ///< Above the mean radius [m]
+
+    [[nodiscard]] std::size_t size() const { return time.size(); }
+    void resize(std::size_t count);
+};
+
+/*
+ * AccessOptions struct - Propagation model and search resolution
+ */
+struct AccessOptions {
+    double timeStep = 60.0;         ///< Visibility sample spacing [s]
+    double timeTolerance = 1e-3;    ///< Rise / set accuracy; culmination uses max(this, timeStep / 100) [s]
+    bool j2Secular = true;          ///< Apply J2 drift of node, perigee and mean anomaly
+};
+
+/*
+ * Ground track of one satellite
+ *
+ * Parameters:
+ *   elements - Osculating elements at startEpoch, Earth-centred inertial
+ *   startEpoch - Seconds past J2000
+ *   duration - Track length [s]
+ *
+ * Throws:
+ *   std::invalid_argument if the orbit is not elliptic, duration is
+ *   negative or timeStep is not positive
+ */
+[[nodiscard]] GroundTrackColumns groundTrack(const KeplerianElements& elements, double startEpoch,
+                                             double duration, const AccessOptions& options = {});
+
+/*
+ * AccessWindow struct - One pass of a satellite above a station's mask
+ */
+struct AccessWindow {
+    std::uint32_t satellite;       ///< Index into the catalogue
+    std::uint32_t station;         ///< Index into the station list
+    double rise;                   ///< Seconds past J2000
+    double set;                    ///< Seconds past J2000
+    double maxElevation;           ///< [rad]
+    double maxElevationTime;       ///< Seconds past J2000
+
+    [[nodiscard]] double duration() const { return set - rise; }
+};
+
+/*
+ * AccessResult struct - Windows found and whether the search finished
+ */
+struct AccessResult {
+    std::vector<AccessWindow> windows;   ///< Ordered by (satellite, station, rise)
+    bool complete = true;                ///< False if cancelled: some satellites were skipped
+};
+
+/*
+ * Every window in [startEpoch, startEpoch + duration] for every
+ * (satellite, station) pair
+ *
+ * The Earth rotation angle is tabulated once per sample and shared by all
+ * satellites. Each satellite's Earth-fixed positions are laid out as
+ * columns, and visibility against a station is a dot product over the
+ * whole column, so the screen vectorizes across samples. Sign changes are
+ * refined to timeTolerance by regula falsi on the exact motion.
+ *
+ * Windows already open at the start or still open at the end are clipped
+ * to the interval. A pass shorter than timeStep can fall between samples
+ * and be missed.
+ *
+ * Parameters:
+ *   token - Optional; once cancelled, satellites not yet started are
+ *   skipped and the windows found so far are returned with
+ *   complete = false
+ *
+ * Throws:
+ *   std::invalid_argument if an orbit is not elliptic, duration is
+ *   negative, or timeStep / timeTolerance is not positive
+ */
+[[nodiscard]] AccessResult findAccessWindows(const KeplerianElementsArray& satellites,
+                                             const std::vector<GroundStation>& stations, double startEpoch,
+                                             double duration, const AccessOptions& options = {},
+                                             const CancellationToken* token = nullptr);
+
+} // namespace hohmann
+
+#endif // HOHMANN_ACCESS_HPP
@@ -0,0 +1,84 @@
+#ifndef HOHMANN_ASSIGNMENT_HPP
+#define HOHMANN_ASSIGNMENT_HPP
+
+/*
+ * assignment.hpp - Constellation reconfiguration: which satellite should
+ * fly to which slot so the fleet spends the least total delta-v?
+ */
+
+#include <cstddef>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * SlotOrbit struct - Circular orbit of a satellite or a target slot
+ */
+struct SlotOrbit {
+    double radius;        ///< [m]
+    double inclination;   ///< [rad]
+    double raan;          ///< Right ascension of ascending node [rad]
+};
+
+/*
+ * Delta-v to move from one circular orbit to another
+ *
+ * Hohmann transfer for the radius change plus a separate plane change of
+ * angle theta, flown where it is cheapest: on the larger of the two circular
+ * orbits, costing 2 v sin(theta / 2).
+ */
+[[nodiscard]] double reconfigurationDeltaV(const SlotOrbit& from, const SlotOrbit& to, double mu);
+
+/*
+ * Dense cost matrix, row-major: cost[i * slots.size() + j] is satellite i
+ * flying to slot j [m/s]
+ *
+ * Built in cache-sized tiles in parallel on the shared scheduler; each
+ * orbit's trigonometry and speed are computed once up front, not per pair.
+ */
+[[nodiscard]] std::vector<double> reconfigurationCostMatrix(const std::vector<SlotOrbit>& satellites,
+                                                            const std::vector<SlotOrbit>& slots,
+                                                            double mu);
+
+/*
+ * Assignment struct - Result of the assignment solver
+ */
+struct Assignment {
+    std::vector<std::size_t> slotOfSatellite;  ///< slotOfSatellite[i] = j
+    double totalCost = 0.0;
+};
+
+/*
+ * Minimum-cost perfect matching on an n x n cost matrix (Hungarian method)
+ *
+ * Shortest-augmenting-path form with row/column potentials, O(n³) worst
+ * case. Rows are scanned contiguously, so the inner loop streams one cache
+ * line after another.
+ *
+ * Each step of the tree growth scans every column twice (slack update,
+ * then potential shift); both scans run on the shared scheduler in chunks
+ * of 2048 columns, so problems below that stay on the calling thread. Ties
+ * go to the lowest column, so the result does not depend on the worker
+ * count. On one core expect about 10 s at n = 5000; a scan is only a few
+ * microseconds, so extra cores help mainly for n well above 10,000.
+ *
+ * To forbid a pairing, give it a large finite cost (e.g. 1e12) rather
+ * than infinity; the potentials must stay finite.
+ *
+ * Throws:
+ *   std::invalid_argument if cost.size() != n * n or any entry is not finite
+ */
+[[nodiscard]] Assignment solveAssignment(const std::vector<double>& cost, std::size_t n);
+
+/*
+ * Build the cost matrix and solve it in one call
+ *
+ * Throws:
+ *   std::invalid_argument if satellites and slots differ in number
+ */
+[[nodiscard]] Assignment planReconfiguration(const std::vector<SlotOrbit>& satellites,
+                                             const std::vector<SlotOrbit>& slots, double mu);
+
+} // namespace hohmann
+
+#endif // HOHMANN_ASSIGNMENT_HPP
@@ -70,6 +70,7 @@ public:
 
     // Pre-defined celestial bodies
     static CelestialBody Sun();
+    static CelestialBody Venus();
     static CelestialBody Earth();
     static CelestialBody Moon();
     static CelestialBody Mars();
@@ -0,0 +1,94 @@
+#ifndef HOHMANN_CONJUNCTION_HPP
+#define HOHMANN_CONJUNCTION_HPP
+
+/*
+ * conjunction.hpp - Close-approach screening of a two-body catalogue with
+ * apsis / orbit-path prefilters and a time-stepped spatial hash
+ */
+
+#include "orbital_elements.hpp"
+#include "scheduler.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * ScreeningOptions struct - Screening window and resolution
+ *
+ * Positions are sampled every timeStep. At each sample every object gets
+ * a box around the path it sweeps in the half steps either side, padded
+ * by half the threshold; only pairs whose boxes overlap are tested. Grid
+ * cells are sized from those boxes, i.e. from the threshold plus the
+ * per-step motion. Longer steps mean fewer samples but longer boxes, so
+ * more pairs to test per sample.
+ */
+struct ScreeningOptions {
+    double threshold = 5e3;       ///< Report approaches closer than this [m]
+    double duration = 86400.0;    ///< Window from the catalogue epoch [s]
+    double timeStep = 60.0;       ///< Sample spacing [s]
+};
+
+/*
+ * Conjunction struct - One close approach (first < second)
+ */
+struct Conjunction {
+    std::uint32_t first;       ///< Catalogue index
+    std::uint32_t second;      ///< Catalogue index
+    double tca;                ///< Time of closest approach from epoch [s]
+    double missDistance;       ///< [m]
+    double relativeSpeed;      ///< At TCA [m/s]
+};
+
+/*
+ * ScreeningStats struct - Work done by each stage, summed over samples
+ */
+struct ScreeningStats {
+    std::uint64_t pairTests = 0;          ///< Pairs whose swept boxes overlap
+    std::uint64_t apsisRejections = 0;    ///< Radial shells do not overlap
+    std::uint64_t motionRejections = 0;   ///< Straight-line motion stays too far apart
+    std::uint64_t pathRejections = 0;     ///< Orbits never come within threshold
+    std::uint64_t candidates = 0;         ///< Sent to TCA refinement
+};
+
+/*
+ * ScreeningResult struct - Conjunctions found and the work it took
+ */
+struct ScreeningResult {
+    std::vector<Conjunction> conjunctions;   ///< Ordered by (tca, first, second)
+    ScreeningStats stats;
+    bool complete = true;                    ///< False if cancelled: some samples or pairs were skipped
+};
+
+/*
+ * Find every approach closer than options.threshold within the window
+ *
+ * Objects move on their two-body orbits from the catalogue epoch (t = 0).
+ * Each pair whose swept boxes overlap at a sample passes, cheapest first:
+ *
+ *   1. apsis filter - [perigee, apogee] shells within threshold
+ *   2. motion filter - straight-line relative motion over the surrounding
+ *      half steps gets within threshold (plus a curvature margin)
+ *   3. path filter - near the line where the two orbit planes intersect,
+ *      the radii of both orbits come within threshold
+ *
+ * Survivors are refined by root-finding d(|r_rel|²)/dt = 0 on the exact
+ * two-body motion. Samples run in parallel on the shared scheduler; no
+ * stage ever loops over all pairs. Approaches whose minimum falls on the
+ * window boundary are not reported. Once the token is cancelled the
+ * remaining work is skipped and the conjunctions found so far are returned
+ * with complete = false.
+ *
+ * Throws:
+ *   std::invalid_argument if threshold, duration or timeStep is not
+ *   positive, or an orbit is not elliptic
+ */
+[[nodiscard]] ScreeningResult screenConjunctions(const KeplerianElementsArray& catalogue, double mu,
+                                                 const ScreeningOptions& options = {},
+                                                 const CancellationToken* token = nullptr);
+
+} // namespace hohmann
+
+#endif // HOHMANN_CONJUNCTION_HPP
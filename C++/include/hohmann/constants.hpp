@@ -11,6 +11,7 @@ namespace hohmann {
 namespace math {
     constexpr double pi = 3.14159265358979323846;
     constexpr double twoPi = 2.0 * pi;
+    constexpr double degToRad = pi / 180.0;
 }
 
 /// Physical constants
@@ -22,6 +23,12 @@ namespace physics {
     constexpr double g0 = 9.80665;
 }
 
+/// Time units [s]
+namespace timeScale {
+    constexpr double day = 86400.0;
+    constexpr double julianYear = 365.25 * day;
+}
+
 /// Gravitational parameters (GM) for various bodies [m³/s²]
 /// Source: NASA JPL planetary fact sheets
 namespace gm {
@@ -48,14 +55,45 @@ namespace orbitalRadius {
     constexpr double saturn = 1.432e12;
     constexpr double uranus = 2.867e12;
     constexpr double neptune = 4.515e12;
+    constexpr double moon = 3.844e8;    // Mean Earth-Moon distance
 }
 
 /// Body radii [m]
 namespace bodyRadius {
     constexpr double sun = 6.9634e8;
+    constexpr double venus = 6.0518e6;
     constexpr double earth = 6.371e6;
     constexpr double moon = 1.7374e6;
     constexpr double mars = 3.3895e6;
+    constexpr double jupiter = 6.9911e7;  // 1 bar level (no solid surface)
+}
+
+/// Second zonal harmonic J2 [-] and the equatorial radius it is referenced to [m]
+/// Source: EGM2008 / WGS-84
+namespace zonal {
+    constexpr double earthJ2 = 1.08262668e-3;
+    constexpr double earthEquatorialRadius = 6.378137e6;
+}
+
+/// Earth orientation at the J2000.0 epoch [deg] and rotation rate [rad/s]
+namespace earthOrientation {
+    constexpr double obliquityJ2000 = 23.4392911;       // Ecliptic to equator
+    constexpr double siderealAngleJ2000 = 280.46061837; // Greenwich mean sidereal angle
+    constexpr double rotationRate = 7.2921158553e-5;    // Sidereal rotation
+}
+
+/// Mean longitudes at the J2000.0 epoch [deg]
+/// Source: JPL approximate planetary positions (Standish), 1800-2050 AD fit
+namespace meanLongitudeJ2000 {
+    constexpr double mercury = 252.25032350;
+    constexpr double venus = 181.97909950;
+    constexpr double earth = 100.46457166;
+    constexpr double mars = 355.44656795;
+    constexpr double jupiter = 34.39644051;
+    constexpr double saturn = 49.95424423;
+    constexpr double uranus = 313.23810451;
+    constexpr double neptune = 304.87997031;
+    constexpr double moon = 218.3164477;  // Geocentric (Meeus)
 }
 
 } // namespace hohmann
@@ -0,0 +1,183 @@
+#ifndef HOHMANN_CR3BP_HPP
+#define HOHMANN_CR3BP_HPP
+
+/*
+ * cr3bp.hpp - Circular restricted three-body problem: Lagrange points and
+ * families of Lyapunov and halo periodic orbits
+ */
+
+#include "celestial_body.hpp"
+#include "ode.hpp"
+#include "vector3.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * Cr3bpState - Nondimensional rotating-frame state {x, y, z, vx, vy, vz}
+ *
+ * Units: distance = primary-secondary separation, time = 1 / (mean motion),
+ * so the primaries sit at (-mu, 0, 0) and (1 - mu, 0, 0) and the frame
+ * rotates at unit rate about +z.
+ */
+using Cr3bpState = OdeState<6>;
+
+/*
+ * Cr3bpVariational - State followed by its 6x6 state-transition matrix
+ * (row-major), integrated together
+ */
+using Cr3bpVariational = OdeState<42>;
+
+enum class LagrangePoint { L1, L2, L3, L4, L5 };
+
+/*
+ * Cr3bpSystem class - Two primaries on circular orbits about their barycenter
+ */
+class Cr3bpSystem {
+public:
+    /*
+     * Parameters:
+     *   primary - Larger body
+     *   secondary - Smaller body
+     *   distance - Separation of the primaries [m]
+     *
+     * Throws:
+     *   std::invalid_argument if distance is not positive or the secondary's
+     *   GM is not smaller than the primary's
+     */
+    Cr3bpSystem(const CelestialBody& primary, const CelestialBody& secondary, double distance);
+
+    /* Earth-Moon system at the mean lunar distance */
+    static Cr3bpSystem EarthMoon();
+
+    [[nodiscard]] double massRatio() const { return m_mu; }       ///< mu = m2 / (m1 + m2)
+    [[nodiscard]] double lengthUnit() const { return m_length; }  ///< [m]
+    [[nodiscard]] double timeUnit() const { return m_time; }      ///< [s]
+    [[nodiscard]] double velocityUnit() const { return m_length / m_time; }  ///< [m/s]
+
+    /* Nondimensional rotating-frame position of a Lagrange point */
+    [[nodiscard]] Vec3 lagrangePoint(LagrangePoint point) const;
+
+    /* Jacobi constant C = 2 U - v² (conserved along every trajectory) */
+    [[nodiscard]] double jacobiConstant(const Cr3bpState& state) const;
+
+    /* Equations of motion: dydt = f(y) */
+    void derivative(const Cr3bpState& state, Cr3bpState& dydt) const;
+
+    /*
+     * Propagate a state by `duration` nondimensional time units
+     *
+     * Returns:
+     *   std::nullopt if the integrator fails (e.g. collision with a primary)
+     */
+    [[nodiscard]] std::optional<Cr3bpState> propagate(const Cr3bpState& state, double duration) const;
+
+    /* State with an identity STM, the starting point for propagateVariational() */
+    [[nodiscard]] static Cr3bpVariational withIdentityStm(const Cr3bpState& state);
+
+    /*
+     * Propagate a state and its STM by `duration` (> 0); the STM keeps
+     * accumulating, so chained calls give Phi(t, 0)
+     *
+     * Returns:
+     *   std::nullopt if the integrator fails
+     */
+    [[nodiscard]] std::optional<Cr3bpVariational> propagateVariational(const Cr3bpVariational& start,
+                                                                       double duration) const;
+
+private:
+    double m_mu;
+    double m_length;
+    double m_time;
+};
+
+enum class PeriodicFamily {
+    PlanarLyapunov,  ///< In-plane orbits around L1 / L2
+    NorthernHalo,    ///< 3-D orbits, maximum excursion toward +z
+    SouthernHalo     ///< Mirror image of the northern family
+};
+
+/*
+ * PeriodicOrbit struct - A corrected member of a family
+ *
+ * initialState lies on the x-z plane (y = 0) with vx = vz = 0, so the orbit
+ * is symmetric about that plane.
+ */
+struct PeriodicOrbit {
+    Cr3bpState initialState;
+    double period;           ///< Nondimensional
+    double jacobiConstant;
+};
+
+/*
+ * Analytic first guess for a periodic orbit about L1 or L2
+ *
+ * Lyapunov: linearized solution with in-plane amplitude `amplitude`.
+ * Halo: Richardson's third-order solution with out-of-plane amplitude
+ * `amplitude` (both nondimensional).
+ *
+ * The libration points are unstable, so a guess only converges when it is
+ * close; seed small orbits (amplitudes of a few percent of the point's
+ * distance from the secondary) and reach larger ones by continuation.
+ *
+ * Throws:
+ *   std::invalid_argument if point is not L1 or L2, or the halo amplitude
+ *   is below the family's bifurcation (no in-plane amplitude exists)
+ */
+[[nodiscard]] PeriodicOrbit periodicOrbitGuess(const Cr3bpSystem& system, LagrangePoint point,
+                                               PeriodicFamily family, double amplitude);
+
+/*
+ * Single-shooting differential correction of a symmetric periodic orbit
+ *
+ * Integrates the state and its 6x6 state-transition matrix to the next
+ * y = 0 crossing and drives vx (and vz for halos) there to zero. Lyapunov
+ * orbits hold x0 fixed and adjust vy0; halos hold z0 fixed and adjust x0
+ * and vy0 - so x0 / z0 act as the family's natural parameter.
+ *
+ * Returns:
+ *   std::nullopt if the iteration does not converge
+ */
+[[nodiscard]] std::optional<PeriodicOrbit> correctPeriodicOrbit(const Cr3bpSystem& system,
+                                                                const PeriodicOrbit& guess,
+                                                                PeriodicFamily family);
+
+/*
+ * ContinuationOptions struct - Natural-parameter continuation controls
+ *
+ * Member k has natural parameter p0 + k * step (x0 for Lyapunov, z0 for
+ * halos). Each guess steps along the family tangent, which falls out of
+ * the previous member's converged Jacobian. Every coarseStride-th member
+ * is computed first, one after another; the members between consecutive
+ * coarse members are then filled in parallel, each segment starting from
+ * its coarse member. A coarse jump that fails is retried through its fine
+ * members.
+ */
+struct ContinuationOptions {
+    double step = 1e-3;              ///< Change in the natural parameter per member
+    std::size_t members = 50;
+    std::size_t coarseStride = 8;
+};
+
+/*
+ * Family of periodic orbits continued from a corrected seed
+ *
+ * Returns:
+ *   Members in order, starting with the (re-corrected) seed; stops early
+ *   at the first member that fails to converge, e.g. at a fold where the
+ *   natural parameter turns back
+ *
+ * Throws:
+ *   std::invalid_argument if step is zero or coarseStride is 0
+ */
+[[nodiscard]] std::vector<PeriodicOrbit> continueFamily(const Cr3bpSystem& system,
+                                                        const PeriodicOrbit& seed,
+                                                        PeriodicFamily family,
+                                                        ContinuationOptions options = {});
+
+} // namespace hohmann
+
+#endif // HOHMANN_CR3BP_HPP
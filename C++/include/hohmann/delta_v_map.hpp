@@ -0,0 +1,266 @@
+#ifndef HOHMANN_DELTA_V_MAP_HPP
+#define HOHMANN_DELTA_V_MAP_HPP
+
+/*
+ * delta_v_map.hpp - "Delta-v subway map": a graph of orbits (LEO, GTO,
+ * GEO, low lunar orbit, Mars orbit, ...) whose edges are the transfers
+ * between them, with shortest-path mission planning
+ */
+
+#include "celestial_body.hpp"
+#include "scheduler.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * LegKind enum - Which engine priced an edge
+ *
+ *   Transfer      Same body: tangent two-burn transfer (HohmannTransfer for
+ *                 circular ends), plane change folded into the outer burn
+ *   Moon          Planet orbit <-> orbit of one of its moons: Hohmann out to
+ *                 the moon's distance, hyperbolic capture / escape there
+ *   Interplanetary  Orbits of two planets: PatchedConicMission
+ *   Custom        Supplied by the caller (launch, aerobraking, ...)
+ */
+enum class LegKind : unsigned char { Transfer, Moon, Interplanetary, Custom };
+
+/*
+ * MapOrbit struct - A node: an orbit around one of the map's bodies
+ *
+ * Orbits are coaxial ellipses given by their apsides (equal for circular
+ * orbits); inclination only matters between orbits of the same body.
+ */
+struct MapOrbit {
+    std::string name;
+    std::size_t body;          ///< Index returned by DeltaVMapBuilder::addBody()
+    double periapsisRadius;    ///< [m]
+    double apoapsisRadius;     ///< [m]
+    double inclination;        ///< To the body's reference plane [rad]
+};
+
+/*
+ * MapLeg struct - One directed edge as seen by path queries
+ */
+struct MapLeg {
+    std::size_t from;
+    std::size_t to;
+    double deltaV;             ///< [m/s]
+    double time;               ///< [s]
+    LegKind kind;
+};
+
+/*
+ * MapPath struct - Route through the map
+ */
+struct MapPath {
+    std::vector<std::size_t> nodes;   ///< From source to target inclusive
+    std::vector<MapLeg> legs;         ///< legs[k] joins nodes[k] and nodes[k + 1]
+    double deltaV = 0.0;              ///< [m/s]
+    double time = 0.0;                ///< Sum of leg times (no coasts or waits) [s]
+};
+
+class DeltaVMap;
+
+/*
+ * DeltaVMapBuilder class - Collects bodies, orbits and connections, then
+ * freezes them into a DeltaVMap
+ *
+ *   DeltaVMapBuilder b;
+ *   auto earth = b.addBody(CelestialBody::Earth());
+ *   auto moon = b.addBody(CelestialBody::Moon(), earth, orbitalRadius::moon);
+ *   auto leo = b.addCircularOrbit("LEO", earth, 6.771e6);
+ *   auto llo = b.addCircularOrbit("LLO", moon, 1.837e6);
+ *   b.connect(leo, llo);
+ *   DeltaVMap map = b.build();
+ */
+class DeltaVMapBuilder {
+public:
+    /* A root body (the Sun, or a planet studied on its own) */
+    std::size_t addBody(const CelestialBody& body);
+
+    /*
+     * A body circling `parent` on a circular orbit
+     *
+     * Throws:
+     *   std::invalid_argument if parent is unknown or orbitRadius is not positive
+     */
+    std::size_t addBody(const CelestialBody& body, std::size_t parent, double orbitRadius);
+
+    /*
+     * Add a node
+     *
+     * Throws:
+     *   std::invalid_argument if the body is unknown or the apsides are not
+     *   0 < periapsisRadius <= apoapsisRadius
+     */
+    std::size_t addOrbit(const std::string& name, std::size_t body, double periapsisRadius,
+                         double apoapsisRadius, double inclination = 0.0);
+    std::size_t addCircularOrbit(const std::string& name, std::size_t body, double radius,
+                                 double inclination = 0.0);
+
+    /*
+     * Price the transfer between two nodes and add it in both directions
+     * (impulsive transfers cost the same flown backwards)
+     *
+     * The engine follows from where the two bodies sit: same body, a
+     * planet and one of its moons, or two bodies circling the same parent.
+     * The two non-Transfer kinds burn at periapsis of each node and ignore
+     * inclination; the hyperbola's plane is free to match the orbit's.
+     *
+     * Throws:
+     *   std::invalid_argument for unknown nodes or bodies that are related
+     *   in none of those ways
+     */
+    void connect(std::size_t a, std::size_t b);
+
+    /*
+     * One-way edge with a caller-supplied cost (launch from a surface
+     * node, aerobraking, a low-thrust spiral, ...)
+     *
+     * Throws:
+     *   std::invalid_argument for unknown nodes or negative deltaV / time
+     */
+    void addLeg(std::size_t from, std::size_t to, double deltaV, double time = 0.0);
+
+    [[nodiscard]] std::size_t nodeCount() const { return m_orbits.size(); }
+
+    /*
+     * Freeze into compressed sparse row form and precompute A* landmarks
+     *
+     * Parameters:
+     *   landmarks - ALT landmarks; each costs two distance columns
+     */
+    [[nodiscard]] DeltaVMap build(std::size_t landmarks = 4) const;
+
+private:
+    struct Body {
+        CelestialBody body;
+        std::optional<std::size_t> parent;
+        double orbitRadius;
+    };
+
+    void checkNode(std::size_t node) const;
+    void checkBody(std::size_t body) const;
+
+    std::vector<Body> m_bodies;
+    std::vector<MapOrbit> m_orbits;
+    std::vector<MapLeg> m_legs;
+};
+
+/*
+ * DeltaVMap class - Immutable delta-v graph in compressed sparse row form
+ *
+ * The out-legs of node v are the contiguous range
+ * [rowStart[v], rowStart[v + 1]) of parallel target / deltaV / time
+ * columns, so a search relaxes a node by streaming one short run of
+ * memory. Searches reuse a per-thread workspace whose entries are reset
+ * lazily by generation stamp, so a query costs only the nodes it touches
+ * and queries may run concurrently.
+ */
+class DeltaVMap {
+public:
+    DeltaVMap() = default;
+
+    [[nodiscard]] std::size_t nodeCount() const { return m_orbits.size(); }
+    [[nodiscard]] std::size_t legCount() const { return m_target.size(); }
+    [[nodiscard]] const MapOrbit& orbit(std::size_t node) const { return m_orbits.at(node); }
+
+    /* Node index by name */
+    [[nodiscard]] std::optional<std::size_t> find(const std::string& name) const;
+
+    /* Out-legs of a node */
+    [[nodiscard]] std::vector<MapLeg> legsFrom(std::size_t node) const;
+
+    /*
+     * Cheapest route by total delta-v (Dijkstra)
+     *
+     * Returns:
+     *   The path, or std::nullopt if target is unreachable
+     *
+     * Throws:
+     *   std::invalid_argument for unknown nodes
+     */
+    [[nodiscard]] std::optional<MapPath> shortestPath(std::size_t source, std::size_t target) const;
+
+    /*
+     * Same route, searched with A* guided by the landmark (ALT) lower
+     * bound: for each landmark L the triangle inequality gives
+     * d(v, t) >= d(L, t) - d(L, v) and d(v, t) >= d(v, L) - d(t, L).
+     * Settles far fewer nodes than Dijkstra on large maps.
+     */
+    [[nodiscard]] std::optional<MapPath> shortestPathAStar(std::size_t source, std::size_t target) const;
+
+    /*
+     * Up to k loopless routes in increasing delta-v order (Yen's algorithm)
+     *
+     * Throws:
+     *   std::invalid_argument for unknown nodes
+     */
+    [[nodiscard]] std::vector<MapPath> kShortestPaths(std::size_t source, std::size_t target,
+                                                      std::size_t k) const;
+
+    /* Cheapest delta-v from source to every node (infinity if unreachable) [m/s] */
+    [[nodiscard]] std::vector<double> deltaVFrom(std::size_t source) const;
+
+    /*
+     * All-pairs delta-v table, row-major: [from * nodeCount() + to] [m/s]
+     *
+     * One Dijkstra per source, run in parallel on the shared scheduler.
+     *
+     * Parameters:
+     *   token - Optional; once cancelled, rows not yet started are left NaN
+     *   (unreachable pairs are infinity)
+     */
+    [[nodiscard]] std::vector<double> deltaVTable(const CancellationToken* token = nullptr) const;
+
+    /*
+     * Inner-solar-system map built from the preset bodies
+     *
+     * Earth: LEO (28.5 deg), ISS, GTO, GEO, high Earth orbit at lunar
+     * distance; Moon: low lunar orbit; Venus, Mars and Jupiter: low and
+     * loosely captured orbits.
+     */
+    static DeltaVMap innerSolarSystem();
+
+private:
+    friend class DeltaVMapBuilder;
+
+    void checkNode(std::size_t node) const;
+    [[nodiscard]] MapLeg leg(std::uint32_t index) const;
+    [[nodiscard]] MapPath makePath(std::size_t source, const std::vector<std::uint32_t>& legs) const;
+    [[nodiscard]] double lowerBound(std::size_t node, std::size_t target) const;
+
+    /*
+     * Single-pair search returning leg indices; guided adds the landmark
+     * bound (A*). Banned nodes / legs (Yen's spur searches) are skipped.
+     */
+    [[nodiscard]] std::optional<std::vector<std::uint32_t>> search(std::size_t source, std::size_t target,
+                                                                   bool guided,
+                                                                   const std::vector<char>* bannedNodes = nullptr,
+                                                                   const std::vector<char>* bannedLegs = nullptr) const;
+
+    std::vector<MapOrbit> m_orbits;
+
+    // Forward CSR
+    std::vector<std::uint32_t> m_rowStart;   // nodeCount() + 1
+    std::vector<std::uint32_t> m_source;     // Tail of each leg, for path tracing
+    std::vector<std::uint32_t> m_target;
+    std::vector<double> m_deltaV;
+    std::vector<double> m_time;
+    std::vector<LegKind> m_kind;
+
+    // ALT landmarks: m_fromLandmark[l * n + v] = d(L_l, v), m_toLandmark[l * n + v] = d(v, L_l)
+    std::size_t m_landmarkCount = 0;
+    std::vector<double> m_fromLandmark;
+    std::vector<double> m_toLandmark;
+};
+
+} // namespace hohmann
+
+#endif // HOHMANN_DELTA_V_MAP_HPP
@@ -0,0 +1,202 @@
+#ifndef HOHMANN_DRAG_HPP
+#define HOHMANN_DRAG_HPP
+
+/*
+ * drag.hpp - Piecewise-exponential atmosphere and orbit-averaged drag decay:
+ * lifetime, altitude after a given time and reboost delta-v
+ */
+
+#include "celestial_body.hpp"
+#include "constants.hpp"
+#include "orbit.hpp"
+#include "scheduler.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * AtmosphereLayer struct - One band of the density table
+ *
+ * Above baseAltitude (up to the next layer's base):
+ *   rho(h) = baseDensity * exp(-(h - baseAltitude) / scaleHeight)
+ */
+struct AtmosphereLayer {
+    double baseAltitude;   ///< [m]
+    double baseDensity;    ///< [kg/m³]
+    double scaleHeight;    ///< [m]
+};
+
+/*
+ * ExponentialAtmosphere class - Static density profile made of exponential bands
+ */
+class ExponentialAtmosphere {
+public:
+    /*
+     * Parameters:
+     *   layers - Bands in increasing baseAltitude order; the first band
+     *            also covers altitudes below its base and the last one
+     *            extends upward without limit
+     *
+     * Throws:
+     *   std::invalid_argument if layers is empty, not strictly increasing,
+     *   or has a non-positive density or scale height
+     */
+    explicit ExponentialAtmosphere(std::vector<AtmosphereLayer> layers);
+
+    /*
+     * Vallado's 0-1000 km table (CIRA-72 based, moderate solar activity)
+     *
+     * Parameters:
+     *   densityScale - Multiplies every density; around 0.5 for solar
+     *                  minimum and 2-5 for solar maximum above 300 km
+     */
+    static ExponentialAtmosphere Standard(double densityScale = 1.0);
+
+    [[nodiscard]] const std::vector<AtmosphereLayer>& layers() const { return m_layers; }
+
+    /// Index of the band containing `altitude`
+    [[nodiscard]] std::size_t layerIndex(double altitude) const;
+
+    /// Density at `altitude` [kg/m³]
+    [[nodiscard]] double density(double altitude) const;
+
+private:
+    std::vector<AtmosphereLayer> m_layers;
+};
+
+/*
+ * DragDecayModel class - Orbit-averaged decay of near-circular orbits
+ *
+ * Drag on a circular orbit shrinks it at
+ *
+ *   da/dt = -rho(h) * sqrt(mu * a) / B,   B = m / (Cd * A)
+ *
+ * so the time to fall from h to the reentry altitude is B times an
+ * integral that depends only on the atmosphere and the body. The model
+ * tabulates that integral at every band boundary once; each spacecraft
+ * then costs one partial-band quadrature, whatever its B.
+ *
+ * Valid while the orbit stays nearly circular and the decay per orbit is
+ * small compared with the scale height - i.e. down to roughly 150 km.
+ */
+class DragDecayModel {
+public:
+    /*
+     * Parameters:
+     *   body - Central body (needs a radius)
+     *   atmosphere - Density profile of that body
+     *   reentryAltitude - Altitude at which the spacecraft counts as decayed [m]
+     *
+     * Throws:
+     *   std::invalid_argument if the body has no radius or reentryAltitude
+     *   is negative
+     */
+    DragDecayModel(const CelestialBody& body, ExponentialAtmosphere atmosphere,
+                   double reentryAltitude = 120e3);
+
+    /// Earth with ExponentialAtmosphere::Standard(densityScale)
+    static DragDecayModel Earth(double densityScale = 1.0);
+
+    [[nodiscard]] const ExponentialAtmosphere& atmosphere() const { return m_atmosphere; }
+    [[nodiscard]] double reentryAltitude() const { return m_reentryAltitude; }
+
+    /*
+     * Rate of change of altitude (negative) [m/s]
+     *
+     * Parameters:
+     *   ballisticCoefficient - B = m / (Cd * A) [kg/m²]
+     */
+    [[nodiscard]] double decayRate(double altitude, double ballisticCoefficient) const;
+
+    /*
+     * Time to decay from `altitude` to the reentry altitude [s]
+     *
+     * Returns 0 at or below the reentry altitude.
+     *
+     * Throws:
+     *   std::invalid_argument if ballisticCoefficient is not positive
+     */
+    [[nodiscard]] double lifetime(double altitude, double ballisticCoefficient) const;
+    [[nodiscard]] double lifetime(const Orbit& orbit, double ballisticCoefficient) const;
+
+    /*
+     * Altitude after `time` seconds of uncontrolled decay
+     *
+     * Returns:
+     *   std::nullopt if the spacecraft reaches the reentry altitude first
+     *
+     * Throws:
+     *   std::invalid_argument if ballisticCoefficient is not positive or
+     *   time is negative
+     */
+    [[nodiscard]] std::optional<double> altitudeAfter(double altitude, double ballisticCoefficient,
+                                                      double time) const;
+
+    /*
+     * Delta-v that holds `altitude` against drag for `duration` [m/s]
+     *
+     * Equal to the drag deceleration 0.5 * rho * v² / B times duration,
+     * whether it is flown as continuous thrust or periodic small burns.
+     */
+    [[nodiscard]] double reboostDeltaV(double altitude, double ballisticCoefficient,
+                                       double duration = timeScale::julianYear) const;
+
+private:
+    // Integral of dh / (rho(h) * sqrt(mu * (R + h))) over [lo, hi] inside band k
+    [[nodiscard]] double bandIntegral(std::size_t k, double lo, double hi) const;
+    // Same integral from the reentry altitude to h
+    [[nodiscard]] double decayIntegral(double altitude) const;
+
+    ExponentialAtmosphere m_atmosphere;
+    double m_mu;
+    double m_radius;
+    double m_reentryAltitude;
+    std::size_t m_firstBand;               // Band containing the reentry altitude
+    std::vector<double> m_bandTop;         // Upper edge of band m_firstBand + i
+    std::vector<double> m_cumulative;      // decayIntegral at m_bandTop[i]
+};
+
+/*
+ * DragColumns struct - Structure-of-arrays fleet description
+ */
+struct DragColumns {
+    std::vector<double> altitude;               ///< Circular-orbit altitude [m]
+    std::vector<double> ballisticCoefficient;   ///< m / (Cd * A) [kg/m²]
+
+    [[nodiscard]] std::size_t size() const { return altitude.size(); }
+    void resize(std::size_t count);
+};
+
+/*
+ * DecayColumns struct - Per-spacecraft decay estimate
+ */
+struct DecayColumns {
+    std::vector<double> lifetime;        ///< Time to reentry [s]
+    std::vector<double> finalAltitude;   ///< After the horizon; reentry altitude if decayed [m]
+    std::vector<double> reboostDeltaV;   ///< To hold the initial altitude over the horizon [m/s]
+
+    [[nodiscard]] std::size_t size() const { return lifetime.size(); }
+    void resize(std::size_t count);
+};
+
+/*
+ * Estimate decay for a whole fleet in one pass
+ *
+ * Parameters:
+ *   horizon - Planning period for finalAltitude and reboostDeltaV [s]
+ *   out - Resized to fleet.size()
+ *   token - Optional; chunks not yet started are left unwritten
+ *
+ * Throws:
+ *   std::invalid_argument if horizon is negative or any ballistic
+ *   coefficient is not positive
+ */
+void estimateDecayBatch(const DragDecayModel& model, const DragColumns& fleet, DecayColumns& out,
+                        double horizon = timeScale::julianYear, const CancellationToken* token = nullptr);
+
+} // namespace hohmann
+
+#endif // HOHMANN_DRAG_HPP
@@ -0,0 +1,200 @@
+#ifndef HOHMANN_ECLIPSE_HPP
+#define HOHMANN_ECLIPSE_HPP
+
+/*
+ * eclipse.hpp - Earth-shadow geometry (cylindrical and conical umbra /
+ * penumbra): analytic intervals for circular orbits and event-based
+ * intervals for general ones
+ */
+
+#include "orbital_elements.hpp"
+#include "propagator.hpp"
+#include "scheduler.hpp"
+#include "vector3.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * ShadowModel enum - Shape of the Earth's shadow
+ *
+ *   Cylindrical  Sun at infinity with zero size: a sharp-edged cylinder of
+ *                Earth's radius; no penumbra
+ *   Conical      Finite Sun disc: a converging umbra cone inside a
+ *                diverging penumbra cone
+ */
+enum class ShadowModel { Cylindrical, Conical };
+
+/*
+ * Fraction of the solar disc visible from `position` (0 in umbra, 1 in
+ * sunlight, in between in penumbra)
+ *
+ * Parameters:
+ *   position - Geocentric satellite position [m]
+ *   sunPosition - Geocentric Sun position [m]
+ */
+[[nodiscard]] double sunlitFraction(const Vec3& position, const Vec3& sunPosition,
+                                    ShadowModel model = ShadowModel::Conical);
+
+/* Geocentric Sun position at an epoch (seconds past J2000), Earth-equatorial frame [m] */
+[[nodiscard]] Vec3 sunPosition(double epoch);
+
+/*
+ * EclipseInterval struct - One passage through a shadow region
+ */
+struct EclipseInterval {
+    double entry;   ///< [s]
+    double exit;    ///< [s]
+
+    [[nodiscard]] double duration() const { return exit - entry; }
+};
+
+/*
+ * CircularEclipse struct - Shadow geometry of one circular orbit at one epoch
+ *
+ * Times are from the epoch; each interval is the next passage whose entry
+ * is at or after the epoch. Cylindrical shadows report the whole shadow as
+ * umbra.
+ */
+struct CircularEclipse {
+    double beta;                              ///< Sun elevation above the orbit plane [rad]
+    double umbraFraction;                     ///< Of each orbit, in full shadow
+    double penumbraFraction;                  ///< Of each orbit, in partial shadow only
+    std::optional<EclipseInterval> umbra;     ///< Next umbra passage
+    std::optional<EclipseInterval> penumbra;  ///< Next passage through the outer cone (contains the umbra)
+
+    [[nodiscard]] double shadowFraction() const { return umbraFraction + penumbraFraction; }
+};
+
+/*
+ * Analytic eclipse of a circular orbit
+ *
+ * With the Sun held fixed over one revolution, the satellite is in shadow
+ * while its angle from the anti-Sun point satisfies
+ *
+ *   cos(delta_u) >= cos(theta*) / cos(beta)
+ *
+ * where theta* is Earth's angular radius (cylinder), minus or plus the
+ * Sun's angular radius (umbra / penumbra cone). The Sun's motion during
+ * the revolution and its parallax are neglected, which shifts LEO entry
+ * and exit by under a second.
+ *
+ * Parameters:
+ *   argumentOfLatitude - Angle from the ascending node at the epoch [rad]
+ *   epoch - Seconds past J2000
+ *
+ * Throws:
+ *   std::invalid_argument if radius is not positive
+ */
+[[nodiscard]] CircularEclipse circularEclipse(double radius, double inclination, double raan,
+                                              double argumentOfLatitude, double epoch,
+                                              ShadowModel model = ShadowModel::Conical);
+
+/*
+ * EclipseOptions struct - Model settings shared by the batch functions
+ */
+struct EclipseOptions {
+    ShadowModel model = ShadowModel::Conical;
+    bool j2Secular = true;     ///< Regress the node between the reference epoch and each epoch
+};
+
+/*
+ * EclipseColumns struct - Structure-of-arrays CircularEclipse summary
+ */
+struct EclipseColumns {
+    std::vector<double> beta;               ///< [rad]
+    std::vector<double> umbraFraction;
+    std::vector<double> penumbraFraction;
+    std::vector<double> umbraDuration;      ///< Per revolution [s]
+
+    [[nodiscard]] std::size_t size() const { return beta.size(); }
+    void resize(std::size_t count);
+};
+
+/*
+ * Eclipse fractions for every (epoch, orbit) pair - orbits x seasons
+ *
+ * Orbits are taken as circular with radius semiMajorAxis (eccentricity is
+ * ignored; use eclipseSummaryBatch for eccentric orbits). The Sun position
+ * and its angular size are computed once per epoch and the inner loop runs
+ * over contiguous orbit columns. Results are row-major:
+ * index = e * orbits.size() + i.
+ *
+ * Parameters:
+ *   referenceEpoch - Epoch of the elements (seconds past J2000)
+ *   epochs - Seasons to evaluate (seconds past J2000)
+ *
+ * Throws:
+ *   std::invalid_argument if any semi-major axis is not positive
+ */
+void circularEclipseGrid(const KeplerianElementsArray& orbits, double referenceEpoch,
+                         const std::vector<double>& epochs, EclipseColumns& out,
+                         const EclipseOptions& options = {}, const CancellationToken* token = nullptr);
+
+/*
+ * Shadow-boundary events for propagateWithEvents()
+ *
+ * g is the angle between the Earth and Sun centres seen from the
+ * satellite, minus the boundary angle: Decreasing fires at entry and
+ * Increasing at exit. Conical returns {umbra, penumbra}, Cylindrical
+ * returns {shadow}. The Sun moves with startEpoch + t.
+ */
+[[nodiscard]] std::vector<EventFunction> shadowEvents(double startEpoch, ShadowModel model = ShadowModel::Conical);
+
+/*
+ * EclipseTimeline struct - Shadow passages of one propagated orbit
+ */
+struct EclipseTimeline {
+    std::vector<EclipseInterval> umbra;      ///< Full shadow (whole shadow if cylindrical)
+    std::vector<EclipseInterval> penumbra;   ///< Outer-cone passages, each containing its umbra
+};
+
+/*
+ * Eclipse intervals of a general orbit by numerical propagation
+ *
+ * Passages already in progress at the start or still open at the end are
+ * clipped to [0, duration].
+ *
+ * Throws:
+ *   std::invalid_argument as propagateWithEvents()
+ *   std::runtime_error if the integrator gives up before `duration`, since
+ *   the timeline would silently miss the remaining passages
+ */
+[[nodiscard]] EclipseTimeline eclipseTimeline(const GravityModel& model, const OrbitState& state,
+                                              double startEpoch, double duration,
+                                              ShadowModel shadow = ShadowModel::Conical,
+                                              const OdeOptions& options = {});
+
+/*
+ * EclipseSummaryColumns struct - Per-orbit shadow totals over a propagation
+ */
+struct EclipseSummaryColumns {
+    std::vector<double> umbraTime;       ///< Total time in full shadow [s]
+    std::vector<double> penumbraTime;    ///< Total time in partial shadow only [s]
+    std::vector<double> longestUmbra;    ///< Longest single umbra passage [s]
+
+    [[nodiscard]] std::size_t size() const { return umbraTime.size(); }
+    void resize(std::size_t count);
+};
+
+/*
+ * Shadow totals for a catalogue of general orbits
+ *
+ * Runs propagateWithEventsBatch() with shadowEvents() and folds each lane's
+ * event log into totals. Lanes whose propagation failed or was skipped by
+ * cancellation hold NaN in every column.
+ *
+ * Throws:
+ *   std::invalid_argument as propagateWithEvents()
+ */
+void eclipseSummaryBatch(const GravityModel& model, const StateVectorArray& initial, double startEpoch,
+                         double duration, EclipseSummaryColumns& out,
+                         ShadowModel shadow = ShadowModel::Conical, const OdeOptions& options = {},
+                         const CancellationToken* token = nullptr);
+
+} // namespace hohmann
+
+#endif // HOHMANN_ECLIPSE_HPP
@@ -0,0 +1,64 @@
+#ifndef HOHMANN_EPHEMERIS_HPP
+#define HOHMANN_EPHEMERIS_HPP
+
+/*
+ * ephemeris.hpp - Simple planetary ephemeris: circular, coplanar heliocentric
+ * orbits phased by mean longitude at J2000
+ */
+
+#include "celestial_body.hpp"
+#include "vector3.hpp"
+
+namespace hohmann {
+
+/*
+ * PlanetEphemeris class - Where a planet is at a given epoch
+ *
+ * Each planet moves on a circle of radius orbitalRadius:: in the ecliptic
+ * plane at constant angular rate. Epochs are seconds past J2000.0
+ * (2000-01-01 12:00 TT). Good to a few percent in delta-v for preliminary
+ * trajectory searches; not a replacement for JPL DE ephemerides.
+ */
+class PlanetEphemeris {
+public:
+    /*
+     * Construct an ephemeris entry
+     *
+     * Parameters:
+     *   body - The planet (supplies GM)
+     *   orbitRadius - Heliocentric orbit radius [m]
+     *   meanLongitudeAtJ2000 - Angle from +x at epoch 0 [rad]
+     *   surfaceRadius - Planet radius used to bound flyby periapsis [m]
+     */
+    PlanetEphemeris(const CelestialBody& body, double orbitRadius,
+                    double meanLongitudeAtJ2000, double surfaceRadius);
+
+    // Accessors
+    [[nodiscard]] const CelestialBody& body() const { return m_body; }
+    [[nodiscard]] double orbitRadius() const { return m_orbitRadius; }
+    [[nodiscard]] double surfaceRadius() const { return m_surfaceRadius; }
+    [[nodiscard]] double meanMotion() const { return m_meanMotion; }
+
+    /* Heliocentric position at epoch [m] */
+    [[nodiscard]] Vec3 position(double epoch) const;
+
+    /* Heliocentric velocity at epoch [m/s] */
+    [[nodiscard]] Vec3 velocity(double epoch) const;
+
+    // Pre-defined planets
+    static PlanetEphemeris Venus();
+    static PlanetEphemeris Earth();
+    static PlanetEphemeris Mars();
+    static PlanetEphemeris Jupiter();
+
+private:
+    CelestialBody m_body;
+    double m_orbitRadius;     // [m]
+    double m_longitude0;      // Mean longitude at J2000 [rad]
+    double m_surfaceRadius;   // [m]
+    double m_meanMotion;      // [rad/s]
+};
+
+} // namespace hohmann
+
+#endif // HOHMANN_EPHEMERIS_HPP
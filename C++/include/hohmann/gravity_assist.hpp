@@ -0,0 +1,154 @@
+#ifndef HOHMANN_GRAVITY_ASSIST_HPP
+#define HOHMANN_GRAVITY_ASSIST_HPP
+
+/*
+ * gravity_assist.hpp - Powered flybys and multiple-gravity-assist (MGA)
+ * trajectory search
+ */
+
+#include "constants.hpp"
+#include "ephemeris.hpp"
+#include "patched_conic.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * Delta-v of a powered flyby that bends vInfIn into vInfOut
+ *
+ * The spacecraft follows an incoming hyperbola, burns tangentially at
+ * periapsis, and leaves on an outgoing hyperbola. The periapsis radius is
+ * chosen so the two half-turns add up to the required bend angle.
+ *
+ * Parameters:
+ *   vInfIn - Incoming hyperbolic excess velocity, planet-relative [m/s]
+ *   vInfOut - Required outgoing excess velocity [m/s]
+ *   mu - Planet gravitational parameter [m³/s²]
+ *   minimumPeriapsis - Lowest allowed periapsis radius [m]
+ *
+ * If either excess velocity is zero there is no bend to make (its
+ * direction is undefined), so the burn is priced at minimumPeriapsis,
+ * where it is cheapest; this is also the limit of the general case.
+ *
+ * Returns:
+ *   Periapsis burn magnitude [m/s], or +infinity if the bend would need a
+ *   periapsis below minimumPeriapsis
+ *
+ * Throws:
+ *   std::invalid_argument if mu or minimumPeriapsis is not positive
+ */
+[[nodiscard]] double poweredFlybyDeltaV(const Vec3& vInfIn, const Vec3& vInfOut,
+                                        double mu, double minimumPeriapsis);
+
+/*
+ * TimeOfFlightRange struct - Grid of candidate durations for one leg
+ */
+struct TimeOfFlightRange {
+    double minimum;     ///< [s]
+    double maximum;     ///< [s]
+    std::size_t steps;  ///< Number of grid points (>= 1)
+};
+
+/*
+ * MgaOptions struct - Search space and mission constraints
+ *
+ * If legTimeOfFlight is empty, each leg gets an automatic range scaled from
+ * the Hohmann transfer time between the two planets' orbits (or the planet's
+ * period for same-planet resonant legs), sampled with timeOfFlightSteps.
+ */
+struct MgaOptions {
+    double departureWindowStart = 0.0;        ///< [s past J2000]
+    double departureWindowEnd = 0.0;          ///< [s past J2000]
+    std::size_t departureSteps = 1;
+    std::vector<TimeOfFlightRange> legTimeOfFlight;
+    std::size_t timeOfFlightSteps = 24;
+    double parkingRadius = bodyRadius::earth + 400e3;  ///< Circular orbit at the first body [m]
+    std::optional<CaptureOrbit> capture;      ///< Capture at the last body; none = count arrival v_inf
+    double minimumFlybyAltitude = 300e3;      ///< [m] above the planet's surface radius
+    std::size_t threadCount = 0;              ///< 0 = TaskScheduler::global()
+};
+
+/*
+ * MgaSolution struct - Best trajectory found
+ */
+struct MgaSolution {
+    std::vector<std::string> sequence;       ///< Body names, departure first
+    double departureEpoch = 0.0;             ///< [s past J2000]
+    std::vector<double> legTimeOfFlight;     ///< [s]
+    double departureDeltaV = 0.0;            ///< [m/s]
+    std::vector<double> flybyDeltaV;         ///< [m/s], one per intermediate body
+    double arrivalDeltaV = 0.0;              ///< [m/s]
+    double totalDeltaV = 0.0;                ///< [m/s]
+
+    [[nodiscard]] double totalTimeOfFlight() const;
+};
+
+/*
+ * MgaSearchStats struct - Work done by the last solve()
+ */
+struct MgaSearchStats {
+    std::size_t lambertSolves = 0;
+    std::size_t branchesPruned = 0;
+};
+
+/*
+ * MgaSearch class - Parallel branch-and-bound over sequences and dates
+ *
+ * Every (sequence, departure date) pair is a root task. Each task walks the
+ * legs depth-first, solving one Lambert arc per candidate time of flight and
+ * patching consecutive arcs with poweredFlybyDeltaV(). Because every cost
+ * term is non-negative, the delta-v accumulated so far is a lower bound on
+ * any completion of that branch; branches whose partial cost already exceeds
+ * the best complete trajectory (shared by all workers) are cut.
+ */
+class MgaSearch {
+public:
+    explicit MgaSearch(MgaOptions options);
+
+    /*
+     * Search all candidate sequences
+     *
+     * Parameters:
+     *   sequences - Each entry lists the bodies visited, departure first
+     *
+     * Returns:
+     *   The cheapest trajectory, or nullopt if no feasible one exists
+     *
+     * Throws:
+     *   std::invalid_argument for sequences shorter than two bodies or a
+     *   legTimeOfFlight list that does not match the number of legs
+     */
+    [[nodiscard]] std::optional<MgaSolution> solve(
+        const std::vector<std::vector<PlanetEphemeris>>& sequences);
+
+    [[nodiscard]] const MgaOptions& options() const { return m_options; }
+    [[nodiscard]] const MgaSearchStats& stats() const { return m_stats; }
+
+private:
+    MgaOptions m_options;
+    MgaSearchStats m_stats;
+};
+
+/*
+ * Enumerate departure -> flybys -> arrival sequences
+ *
+ * Parameters:
+ *   departure - First body
+ *   arrival - Last body
+ *   flybyBodies - Candidate intermediate bodies (repeats allowed)
+ *   maxFlybys - Longest chain of intermediate bodies to generate
+ *
+ * Returns:
+ *   All sequences with 0..maxFlybys flybys, shortest first
+ */
+[[nodiscard]] std::vector<std::vector<PlanetEphemeris>> enumerateSequences(
+    const PlanetEphemeris& departure, const PlanetEphemeris& arrival,
+    const std::vector<PlanetEphemeris>& flybyBodies, std::size_t maxFlybys);
+
+} // namespace hohmann
+
+#endif // HOHMANN_GRAVITY_ASSIST_HPP
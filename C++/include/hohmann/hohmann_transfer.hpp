@@ -7,21 +7,40 @@
 
 #include "orbit.hpp"
 
+#include <array>
+
 namespace hohmann {
 
 /*
- * TransferResult struct - Contains the results of a Hohmann transfer calculation
+ * BasicTransferResult struct - Contains the results of a Hohmann transfer calculation
+ *
+ * Templated on the number type so the kernels in transfer_kernel.hpp can
+ * run on dual numbers (dual.hpp) and return derivatives alongside values.
+ * Everyday code uses the double instantiation, TransferResult.
  */
-struct TransferResult {
-    double deltaV1;        ///< First burn delta-v [m/s] (departure)
-    double deltaV2;        ///< Second burn delta-v [m/s] (arrival)
-    double totalDeltaV;   ///< Total delta-v required [m/s]
-    double transferTime;   ///< Transfer time [seconds]
-    double semiMajorAxis; ///< Transfer orbit semi-major axis [m]
+template <class T>
+struct BasicTransferResult {
+    T deltaV1;        ///< First burn delta-v [m/s] (departure)
+    T deltaV2;        ///< Second burn delta-v [m/s] (arrival)
+    T totalDeltaV;   ///< Total delta-v required [m/s]
+    T transferTime;   ///< Transfer time [seconds]
+    T semiMajorAxis; ///< Transfer orbit semi-major axis [m]
 
     // Derived values
-    [[nodiscard]] double transferTimeHours() const { return transferTime / 3600.0; }
-    [[nodiscard]] double transferTimeDays() const { return transferTime / 86400.0; }
+    [[nodiscard]] T transferTimeHours() const { return transferTime / 3600.0; }
+    [[nodiscard]] T transferTimeDays() const { return transferTime / 86400.0; }
+};
+
+using TransferResult = BasicTransferResult<double>;
+
+/*
+ * TransferGradient struct - A transfer and the sensitivities of its two
+ * figures of merit to the inputs, in the order (r1, r2, mu)
+ */
+struct TransferGradient {
+    TransferResult result;
+    std::array<double, 3> totalDeltaV;    ///< [m/s per m, m/s per m, m/s per m³/s²]
+    std::array<double, 3> transferTime;   ///< [s per m, s per m, s per m³/s²]
 };
 
 /*
@@ -35,6 +54,9 @@ struct TransferResult {
  * 1. First burn (delta_v1): At periapsis of transfer orbit, raises apoapsis
  * 2. Coast along transfer ellipse (half orbital period)
  * 3. Second burn (delta_v2): At apoapsis, circularizes the orbit
+ *
+ * For elliptical (coaxial) endpoints and for evaluating many transfers at
+ * once, see transfer_kernel.hpp and transfer_batch.hpp.
  */
 class HohmannTransfer {
 public:
@@ -74,6 +96,12 @@ public:
      */
     [[nodiscard]] double phaseAngle() const;
 
+    /*
+     * Exact derivatives of totalDeltaV and transferTime with respect to
+     * both radii and mu, from one dual-number evaluation of the transfer
+     */
+    [[nodiscard]] TransferGradient gradient() const;
+
     /* Print a summary of the transfer to stdout */
     void printSummary() const;
 
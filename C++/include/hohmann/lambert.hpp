@@ -0,0 +1,47 @@
+#ifndef HOHMANN_LAMBERT_HPP
+#define HOHMANN_LAMBERT_HPP
+
+/*
+ * lambert.hpp - Lambert's problem: the orbit connecting two positions in a
+ * given time of flight
+ */
+
+#include "vector3.hpp"
+
+#include <optional>
+
+namespace hohmann {
+
+/*
+ * LambertSolution struct - Velocities at both ends of the connecting arc
+ */
+struct LambertSolution {
+    Vec3 departureVelocity;  ///< Inertial velocity at r1 [m/s]
+    Vec3 arrivalVelocity;    ///< Inertial velocity at r2 [m/s]
+};
+
+/*
+ * Solve Lambert's problem for a zero-revolution transfer
+ *
+ * Parameters:
+ *   r1 - Departure position [m]
+ *   r2 - Arrival position [m]
+ *   timeOfFlight - Transfer duration [s]
+ *   mu - Gravitational parameter [m³/s²]
+ *   prograde - true for motion counter-clockwise about +z (the usual case)
+ *
+ * Returns:
+ *   The solution, or nullopt if the geometry is degenerate (r1 and r2
+ *   exactly 180 degrees apart, where the transfer plane is undefined) or
+ *   the iteration fails to converge
+ *
+ * Throws:
+ *   std::invalid_argument if timeOfFlight is not positive
+ */
+[[nodiscard]] std::optional<LambertSolution> solveLambert(const Vec3& r1, const Vec3& r2,
+                                                          double timeOfFlight, double mu,
+                                                          bool prograde = true);
+
+} // namespace hohmann
+
+#endif // HOHMANN_LAMBERT_HPP
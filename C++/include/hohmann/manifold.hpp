@@ -0,0 +1,129 @@
+#ifndef HOHMANN_MANIFOLD_HPP
+#define HOHMANN_MANIFOLD_HPP
+
+/*
+ * manifold.hpp - Stable / unstable invariant manifolds of CR3BP periodic
+ * orbits, sampled where they pierce a Poincaré section
+ */
+
+#include "cr3bp.hpp"
+#include "scheduler.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hohmann {
+
+enum class ManifoldBranch {
+    Unstable,  ///< Departs the orbit: integrated forward in time
+    Stable     ///< Approaches the orbit: integrated backward in time
+};
+
+/*
+ * PoincareSection struct - Hypersurface state[coordinate] = value
+ *
+ * coordinate indexes Cr3bpState (0..2 position, 3..5 velocity). direction
+ * filters crossings by the sign of d(state[coordinate])/dt in physical
+ * time, also for backward-integrated stable manifolds. Example: the plane
+ * through the Moon perpendicular to the Earth-Moon line is
+ * {0, 1 - mu, CrossingDirection::Any}.
+ */
+struct PoincareSection {
+    std::size_t coordinate = 0;
+    double value = 0.0;
+    CrossingDirection direction = CrossingDirection::Any;
+};
+
+/*
+ * ManifoldOptions struct - Sampling and integration controls
+ *
+ * Each of the `seeds` points (equally spaced in time around the orbit) is
+ * displaced by +/- perturbation along the local eigenvector, giving
+ * 2 * seeds trajectories.
+ */
+struct ManifoldOptions {
+    std::size_t seeds = 200;
+    double perturbation = 1e-4;      ///< Position displacement (nondimensional; ~38 km Earth-Moon)
+    double maxTime = 10.0;           ///< Flight time per trajectory (nondimensional)
+    std::size_t maxCrossings = 4;    ///< Section crossings recorded per trajectory
+    double tolerance = 1e-10;        ///< Integrator relative and absolute tolerance
+};
+
+/*
+ * SectionCrossings struct - Columnar buffer of Poincaré section crossings
+ *
+ * Rows are ordered by trajectory, then by crossing. trajectory = 2 * seed
+ * + side, where side 0 is the displacement along the eigenvector oriented
+ * with a non-negative x component at the orbit's initial state (and carried
+ * continuously around the orbit) and side 1 the opposite one. time is the
+ * physical flight time from the orbit (negative on stable manifolds).
+ */
+struct SectionCrossings {
+    std::vector<std::uint32_t> trajectory;
+    std::vector<std::uint16_t> crossing;   ///< 0 = first crossing of that trajectory
+    std::vector<double> time;
+    std::vector<double> x, y, z;
+    std::vector<double> vx, vy, vz;
+
+    [[nodiscard]] std::size_t size() const { return trajectory.size(); }
+    void resize(std::size_t count);
+
+    /* Column for a Cr3bpState coordinate index (0..5) */
+    [[nodiscard]] const std::vector<double>& column(std::size_t coordinate) const;
+
+    [[nodiscard]] Cr3bpState state(std::size_t index) const {
+        return {x[index], y[index], z[index], vx[index], vy[index], vz[index]};
+    }
+};
+
+/*
+ * Sample one branch of a periodic orbit's manifold on a Poincaré section
+ *
+ * The monodromy matrix (STM over one period) is computed once; its
+ * dominant eigenvector (or that of its inverse, for the stable branch) is
+ * carried around the orbit by the STM to seed every point. The 2 * seeds
+ * trajectories are then integrated in parallel on the shared scheduler.
+ *
+ * Parameters:
+ *   token - Optional; trajectories not yet started are skipped once cancelled
+ *
+ * Throws:
+ *   std::invalid_argument if seeds is 0, coordinate > 5, or the orbit is
+ *   not unstable (no real eigenvalue pair off the unit circle)
+ *   std::runtime_error if the orbit itself cannot be integrated
+ */
+[[nodiscard]] SectionCrossings generateManifold(const Cr3bpSystem& system, const PeriodicOrbit& orbit,
+                                                ManifoldBranch branch, const PoincareSection& section,
+                                                ManifoldOptions options = {},
+                                                const CancellationToken* token = nullptr);
+
+/*
+ * SectionMatch struct - Rows of two crossing buffers that nearly coincide
+ */
+struct SectionMatch {
+    std::size_t first;    ///< Row in the first buffer
+    std::size_t second;   ///< Row in the second buffer
+    double distance;      ///< Largest |difference| over the compared coordinates
+};
+
+/*
+ * Pairs of crossings that agree within `tolerance` in every listed
+ * coordinate - e.g. {1, 4} (y, vy) on an x = const section, to connect an
+ * unstable manifold to a stable one
+ *
+ * The second buffer is sorted once on the first coordinate; each row of the
+ * first buffer then scans only the window within tolerance of its key.
+ * Results are ordered by (first, second).
+ *
+ * Throws:
+ *   std::invalid_argument if coordinates is empty or contains an index > 5
+ */
+[[nodiscard]] std::vector<SectionMatch> matchSectionCrossings(const SectionCrossings& first,
+                                                              const SectionCrossings& second,
+                                                              const std::vector<std::size_t>& coordinates,
+                                                              double tolerance);
+
+} // namespace hohmann
+
+#endif // HOHMANN_MANIFOLD_HPP
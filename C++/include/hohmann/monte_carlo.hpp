@@ -0,0 +1,106 @@
+#ifndef HOHMANN_MONTE_CARLO_HPP
+#define HOHMANN_MONTE_CARLO_HPP
+
+/*
+ * monte_carlo.hpp - Monte Carlo dispersion analysis of transfer delta-v
+ */
+
+#include "hohmann_transfer.hpp"
+#include "quantile_sketch.hpp"
+#include "scheduler.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hohmann {
+
+/*
+ * TransferUncertainty struct - 1-sigma Gaussian dispersions
+ *
+ * Radius sigmas are absolute; burn and GM sigmas are fractions of the
+ * nominal value (0.01 = 1%).
+ */
+struct TransferUncertainty {
+    double initialRadiusSigma = 0.0;  ///< [m]
+    double finalRadiusSigma = 0.0;    ///< [m]
+    double burnErrorSigma = 0.0;      ///< Fractional burn magnitude error, each burn
+    double gmSigma = 0.0;             ///< Fractional error in the body's GM
+};
+
+/*
+ * MonteCarloOptions struct - Sample count and reproducibility controls
+ *
+ * Sample i always draws the same random numbers for a given seed, so a run
+ * is bit-for-bit reproducible on any number of threads. blockSize is the
+ * number of samples generated and evaluated together.
+ */
+struct MonteCarloOptions {
+    std::size_t samples = 1'000'000;
+    std::uint64_t seed = 0;
+    std::size_t blockSize = 4096;
+    double sketchAccuracy = 0.001;  ///< Relative error of reported percentiles
+};
+
+/*
+ * DispersionStatistics struct - Streaming summary of a Monte Carlo run
+ *
+ * Percentiles come from the sketches, e.g. totalDeltaV.quantile(0.997) for
+ * the 3-sigma-equivalent margin. No individual samples are stored.
+ */
+struct DispersionStatistics {
+    std::size_t samples = 0;            ///< Samples evaluated (fewer if cancelled)
+    QuantileSketch totalDeltaV;         ///< [m/s]
+    QuantileSketch deltaV1;             ///< [m/s]
+    QuantileSketch deltaV2;             ///< [m/s]
+    QuantileSketch transferTime;        ///< [s]
+    double meanTotalDeltaV = 0.0;       ///< [m/s]
+    double stdDevTotalDeltaV = 0.0;     ///< [m/s]
+
+    explicit DispersionStatistics(double sketchAccuracy)
+        : totalDeltaV(sketchAccuracy), deltaV1(sketchAccuracy),
+          deltaV2(sketchAccuracy), transferTime(sketchAccuracy) {}
+};
+
+/*
+ * TransferMonteCarlo class - Dispersed re-evaluation of a nominal transfer
+ *
+ * Each sample perturbs both orbit radii and GM, evaluates the transfer with
+ * the inline kernel from transfer_kernel.hpp, then applies burn execution
+ * error: a burn planned at dv is executed with magnitude error eps * dv and
+ * trimmed afterwards, so it costs dv * (1 + |eps|).
+ *
+ * Samples are processed in fixed-size blocks on the shared TaskScheduler;
+ * per-chunk sketches are merged at the end, which is exact.
+ */
+class TransferMonteCarlo {
+public:
+    /*
+     * Throws:
+     *   std::invalid_argument if any sigma is negative, a radius sigma
+     *   exceeds 10% of its radius, gmSigma exceeds 10%, or blockSize is 0
+     */
+    TransferMonteCarlo(const HohmannTransfer& nominal, TransferUncertainty uncertainty,
+                       MonteCarloOptions options = {});
+
+    /*
+     * Run all samples
+     *
+     * Parameters:
+     *   token - Optional; blocks not yet started are skipped once cancelled
+     */
+    [[nodiscard]] DispersionStatistics run(const CancellationToken* token = nullptr) const;
+
+    [[nodiscard]] const TransferUncertainty& uncertainty() const { return m_uncertainty; }
+    [[nodiscard]] const MonteCarloOptions& options() const { return m_options; }
+
+private:
+    double m_r1;
+    double m_r2;
+    double m_mu;
+    TransferUncertainty m_uncertainty;
+    MonteCarloOptions m_options;
+};
+
+} // namespace hohmann
+
+#endif // HOHMANN_MONTE_CARLO_HPP
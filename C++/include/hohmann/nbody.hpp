@@ -0,0 +1,152 @@
+#ifndef HOHMANN_NBODY_HPP
+#define HOHMANN_NBODY_HPP
+
+/*
+ * nbody.hpp - Barnes-Hut N-body integration of massive bodies and test
+ * particles, with Morton-ordered particle storage
+ */
+
+#include "scheduler.hpp"
+#include "vector3.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * ParticleColumns struct - Structure-of-arrays particle storage
+ *
+ * gm = 0 marks a massless test particle (asteroid, debris fragment): it
+ * feels every massive body but pulls on nothing. id is assigned by add()
+ * and survives the Morton reordering done by NBodySimulation.
+ */
+struct ParticleColumns {
+    std::vector<double> x, y, z;     ///< Position [m]
+    std::vector<double> vx, vy, vz;  ///< Velocity [m/s]
+    std::vector<double> gm;          ///< Gravitational parameter [m³/s²]
+    std::vector<std::uint32_t> id;
+
+    [[nodiscard]] std::size_t size() const { return x.size(); }
+    void resize(std::size_t count);
+
+    /* Append a particle; returns its id (its index at the time of adding) */
+    std::uint32_t add(const Vec3& position, const Vec3& velocity, double gm = 0.0);
+
+    [[nodiscard]] Vec3 position(std::size_t index) const { return {x[index], y[index], z[index]}; }
+    [[nodiscard]] Vec3 velocity(std::size_t index) const { return {vx[index], vy[index], vz[index]}; }
+};
+
+/*
+ * Sun, Venus, Earth, Moon, Mars and Jupiter at an epoch
+ *
+ * Planets come from the PlanetEphemeris presets and the Moon from a circular
+ * geocentric orbit phased by its J2000 mean longitude, all with the
+ * CelestialBody GM values. The result is shifted to the barycentric frame so
+ * the system does not drift. Ids follow the order listed above.
+ *
+ * Parameters:
+ *   epoch - Seconds past J2000.0
+ */
+[[nodiscard]] ParticleColumns solarSystemParticles(double epoch = 0.0);
+
+/*
+ * BarnesHutOptions struct - Accuracy / speed controls
+ *
+ * A tree cell of size s whose centre of mass is d away is used as a single
+ * point mass when d > s / theta + offset (offset = distance from the cell's
+ * centre to its centre of mass). theta = 0 opens every cell and reduces to
+ * direct summation; 0.5 gives mean force errors around 0.1 %, 1.0 around 1 %.
+ */
+struct BarnesHutOptions {
+    double theta = 0.5;            ///< Opening angle
+    double softening = 0.0;        ///< Plummer softening length [m]
+    std::size_t leafSize = 8;      ///< Particles per leaf cell before it splits
+};
+
+/*
+ * OctreeNode struct - One cell of the Barnes-Hut tree
+ *
+ * A cell covers the Morton-sorted particles [begin, end); its children are
+ * stored contiguously from firstChild.
+ */
+struct OctreeNode {
+    double x, y, z;                ///< Centre of mass [m]
+    double gm;                     ///< Total GM of the cell [m³/s²]
+    double openRadius2;            ///< Squared distance below which the cell is opened [m²]
+    double centerX, centerY, centerZ;
+    double size;                   ///< Edge length [m]
+    std::uint32_t begin, end;
+    std::uint32_t firstChild;
+    std::uint32_t childCount;
+};
+
+/*
+ * NBodySimulation class - Kick-drift-kick leapfrog on a Barnes-Hut tree
+ *
+ * Every step re-sorts the particles along a Morton (Z-order) curve, so
+ * particles close in space are close in memory, rebuilds the octree (the
+ * subtrees in parallel) and evaluates all accelerations in parallel on the
+ * shared scheduler. Leapfrog is symplectic: with a fixed step the energy
+ * error stays bounded instead of drifting.
+ */
+class NBodySimulation {
+public:
+    /*
+     * Throws:
+     *   std::invalid_argument if there are no particles, more than 2^32 - 1,
+     *   theta or softening is negative, or leafSize is 0
+     */
+    explicit NBodySimulation(ParticleColumns particles, BarnesHutOptions options = {});
+
+    /* Current particles in Morton order (see ParticleColumns::id) */
+    [[nodiscard]] const ParticleColumns& particles() const { return m_particles; }
+
+    /* Current particles in id order */
+    [[nodiscard]] ParticleColumns particlesById() const;
+
+    [[nodiscard]] const std::vector<OctreeNode>& tree() const { return m_tree; }
+    [[nodiscard]] double time() const { return m_time; }   ///< [s]
+
+    /* Acceleration of the particle at a (Morton-order) index [m/s²] */
+    [[nodiscard]] Vec3 acceleration(std::size_t index) const { return {m_ax[index], m_ay[index], m_az[index]}; }
+
+    /*
+     * Advance by one leapfrog step
+     *
+     * Throws:
+     *   std::invalid_argument if dt is not positive
+     */
+    void step(double dt);
+
+    /*
+     * Advance by `steps` steps of dt
+     *
+     * Returns:
+     *   Steps completed (fewer than requested only if cancelled)
+     */
+    std::size_t run(double dt, std::size_t steps, const CancellationToken* token = nullptr);
+
+    /*
+     * Total energy times G, E * G = sum gm v² / 2 - sum gm_i gm_j / r_ij,
+     * over massive particles by direct summation [m⁵/s⁴]
+     */
+    [[nodiscard]] double energy() const;
+
+private:
+    void rebuild();
+
+    ParticleColumns m_particles;
+    ParticleColumns m_scratch;                                   // Reorder buffer
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> m_keys;  // (Morton code, index)
+    BarnesHutOptions m_options;
+    std::vector<OctreeNode> m_tree;
+    std::vector<double> m_ax, m_ay, m_az;
+    double m_time = 0.0;
+};
+
+} // namespace hohmann
+
+#endif // HOHMANN_NBODY_HPP
@@ -0,0 +1,264 @@
+#ifndef HOHMANN_ODE_HPP
+#define HOHMANN_ODE_HPP
+
+/*
+ * ode.hpp - Adaptive Dormand-Prince 5(4) integration of fixed-size systems
+ *
+ * The state is a std::array, so integrating (even a 42-component state plus
+ * STM) never touches the heap; the right-hand side is any callable
+ * f(t, y, dydt) and is inlined into the stepper.
+ */
+
+#include "root_finding.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace hohmann {
+
+template <std::size_t N>
+using OdeState = std::array<double, N>;
+
+/*
+ * Direction filter for sign changes of a switching (event) function
+ */
+enum class CrossingDirection { Any, Increasing, Decreasing };
+
+/* Whether a crossing at which the switching function has slope `rate` passes the filter */
+inline bool directionMatches(CrossingDirection direction, double rate) {
+    switch (direction) {
+        case CrossingDirection::Increasing: return rate > 0.0;
+        case CrossingDirection::Decreasing: return rate < 0.0;
+        case CrossingDirection::Any:        break;
+    }
+    return true;
+}
+
+/*
+ * OdeOptions struct - Error tolerances and step limits
+ *
+ * A step is accepted when the RMS over components of
+ * error / (absoluteTolerance + relativeTolerance * |y|) is at most 1.
+ */
+struct OdeOptions {
+    double relativeTolerance = 1e-12;
+    double absoluteTolerance = 1e-12;
+    double initialStep = 1e-3;   ///< First trial step (same units as t)
+    std::size_t maxSteps = 1'000'000;
+};
+
+/*
+ * DenseOutput struct - Continuous extension of one Dormand-Prince step
+ *
+ * Hairer's 4th-order interpolant: evaluating at any t in [t0, t0 + h] costs
+ * a few multiply-adds per component and no right-hand-side calls, which is
+ * what makes event root-finding inside a step cheap.
+ */
+template <std::size_t N>
+struct DenseOutput {
+    double t0 = 0.0;
+    double h = 0.0;
+    std::array<OdeState<N>, 5> coefficients{};
+
+    [[nodiscard]] OdeState<N> operator()(double t) const {
+        const double theta = (t - t0) / h;
+        const double theta1 = 1.0 - theta;
+        const auto& [r1, r2, r3, r4, r5] = coefficients;
+        OdeState<N> y;
+        for (std::size_t i = 0; i < N; ++i) {
+            y[i] = r1[i] + theta * (r2[i] + theta1 * (r3[i] + theta * (r4[i] + theta1 * r5[i])));
+        }
+        return y;
+    }
+};
+
+namespace detail {
+
+/**
+ * One Dormand-Prince step of size h from (t, y) with k1 = f(t, y) already
+ * known. Writes the 5th-order solution and f at it (first-same-as-last) and
+ * returns the scaled error norm. When `dense` is given it also receives the
+ * step's interpolant (meaningful only if the step is accepted).
+ */
+template <std::size_t N, class Rhs>
+double dopri5Step(const Rhs& f, double t, const OdeState<N>& y, const OdeState<N>& k1,
+                  double h, OdeState<N>& yNew, OdeState<N>& k7, const OdeOptions& options,
+                  DenseOutput<N>* dense = nullptr) {
+    OdeState<N> k2, k3, k4, k5, k6, tmp;
+    for (std::size_t i = 0; i < N; ++i) {
+        tmp[i] = y[i] + h * (1.0 / 5.0) * k1[i];
+    }
+    f(t + h * (1.0 / 5.0), tmp, k2);
+    for (std::size_t i = 0; i < N; ++i) {
+        tmp[i] = y[i] + h * (3.0 / 40.0 * k1[i] + 9.0 / 40.0 * k2[i]);
+    }
+    f(t + h * (3.0 / 10.0), tmp, k3);
+    for (std::size_t i = 0; i < N; ++i) {
+        tmp[i] = y[i] + h * (44.0 / 45.0 * k1[i] - 56.0 / 15.0 * k2[i] + 32.0 / 9.0 * k3[i]);
+    }
+    f(t + h * (4.0 / 5.0), tmp, k4);
+    for (std::size_t i = 0; i < N; ++i) {
+        tmp[i] = y[i] + h * (19372.0 / 6561.0 * k1[i] - 25360.0 / 2187.0 * k2[i]
+                             + 64448.0 / 6561.0 * k3[i] - 212.0 / 729.0 * k4[i]);
+    }
+    f(t + h * (8.0 / 9.0), tmp, k5);
+    for (std::size_t i = 0; i < N; ++i) {
+        tmp[i] = y[i] + h * (9017.0 / 3168.0 * k1[i] - 355.0 / 33.0 * k2[i]
+                             + 46732.0 / 5247.0 * k3[i] + 49.0 / 176.0 * k4[i]
+                             - 5103.0 / 18656.0 * k5[i]);
+    }
+    f(t + h, tmp, k6);
+    for (std::size_t i = 0; i < N; ++i) {
+        yNew[i] = y[i] + h * (35.0 / 384.0 * k1[i] + 500.0 / 1113.0 * k3[i] + 125.0 / 192.0 * k4[i]
+                              - 2187.0 / 6784.0 * k5[i] + 11.0 / 84.0 * k6[i]);
+    }
+    f(t + h, yNew, k7);
+
+    if (dense) {
+        dense->t0 = t;
+        dense->h = h;
+        auto& [r1, r2, r3, r4, r5] = dense->coefficients;
+        for (std::size_t i = 0; i < N; ++i) {
+            const double ydiff = yNew[i] - y[i];
+            const double bspl = h * k1[i] - ydiff;
+            r1[i] = y[i];
+            r2[i] = ydiff;
+            r3[i] = bspl;
+            r4[i] = ydiff - h * k7[i] - bspl;
+            r5[i] = h * (-12715105075.0 / 11282082432.0 * k1[i] + 87487479700.0 / 32700410799.0 * k3[i]
+                         - 10690763975.0 / 1880347072.0 * k4[i] + 701980252875.0 / 199316789632.0 * k5[i]
+                         - 1453857185.0 / 822651844.0 * k6[i] + 69997945.0 / 29380423.0 * k7[i]);
+        }
+    }
+
+    double sum = 0.0;
+    for (std::size_t i = 0; i < N; ++i) {
+        double err = h * (71.0 / 57600.0 * k1[i] - 71.0 / 16695.0 * k3[i] + 71.0 / 1920.0 * k4[i]
+                          - 17253.0 / 339200.0 * k5[i] + 22.0 / 525.0 * k6[i] - 1.0 / 40.0 * k7[i]);
+        double scale = options.absoluteTolerance
+                     + options.relativeTolerance * std::max(std::abs(y[i]), std::abs(yNew[i]));
+        sum += (err / scale) * (err / scale);
+    }
+    return std::sqrt(sum / static_cast<double>(N));
+}
+
+/* Standard step-size controller: safety 0.9, growth limited to [0.2, 5] */
+inline double nextStep(double h, double error) {
+    double factor = error > 0.0 ? 0.9 * std::pow(error, -0.2) : 5.0;
+    return h * std::clamp(factor, 0.2, 5.0);
+}
+
+/**
+ * Root of g on [tLo, tHi] (gLo and gHi of opposite sign) on one step's
+ * dense output; see illinoisRoot() for the bracket end returned
+ */
+template <std::size_t N, class Event>
+double refineRoot(const Event& g, const DenseOutput<N>& dense,
+                  double tLo, double gLo, double tHi, double gHi) {
+    return illinoisRoot([&](double t) { return g(t, dense(t)); }, tLo, gLo, tHi, gHi,
+                        1e-15 * std::max(1.0, std::abs(tHi)));
+}
+
+} // namespace detail
+
+/*
+ * Integrate y from t to tEnd (tEnd > t)
+ *
+ * Parameters:
+ *   f - Right-hand side, f(t, y, dydt)
+ *   t - Start time; set to tEnd on success
+ *   y - Initial state; overwritten with the state at tEnd
+ *
+ * Returns:
+ *   false if maxSteps was exhausted or the step size underflowed
+ */
+template <std::size_t N, class Rhs>
+bool integrateOde(const Rhs& f, double& t, OdeState<N>& y, double tEnd,
+                  const OdeOptions& options = {}) {
+    OdeState<N> k1, k7, yNew;
+    f(t, y, k1);
+    double h = std::min(options.initialStep, tEnd - t);
+    for (std::size_t step = 0; step < options.maxSteps; ++step) {
+        if (t >= tEnd) {
+            return true;
+        }
+        h = std::min(h, tEnd - t);
+        double error = detail::dopri5Step(f, t, y, k1, h, yNew, k7, options);
+        if (error <= 1.0) {
+            t = (h == tEnd - t) ? tEnd : t + h;
+            y = yNew;
+            k1 = k7;
+        }
+        h = detail::nextStep(h, error);
+        if (h < 1e-15 * std::max(1.0, std::abs(t))) {
+            return false;
+        }
+    }
+    return t >= tEnd;
+}
+
+/*
+ * Integrate until the event function g(t, y) changes sign, or until tMax
+ *
+ * g is evaluated at the start too, so a crossing inside the very first
+ * step is found. If g is exactly zero at the start (e.g. starting on a
+ * plane crossing, or restarting from the previous event) that zero is
+ * not reported; the next sign change after it is. The crossing is located
+ * inside its step by Illinois regula falsi on the step's dense output,
+ * which costs no extra right-hand-side calls.
+ *
+ * Parameters:
+ *   stepSize - If given, receives the step size the controller would try
+ *              next; pass it as initialStep when continuing past the event
+ *              so the restart does not fall back to the default
+ *
+ * Returns:
+ *   true if the event was found; t and y are then at the event, on the
+ *   side where g has its new sign (or is zero)
+ */
+template <std::size_t N, class Rhs, class Event>
+bool integrateToEvent(const Rhs& f, double& t, OdeState<N>& y, double tMax, const Event& g,
+                      const OdeOptions& options = {}, double* stepSize = nullptr) {
+    OdeState<N> k1, k7, yNew;
+    DenseOutput<N> dense;
+    f(t, y, k1);
+    double h = std::min(options.initialStep, tMax - t);
+    double gPrev = g(t, y);
+
+    for (std::size_t step = 0; step < options.maxSteps && t < tMax; ++step) {
+        h = std::min(h, tMax - t);
+        double error = detail::dopri5Step(f, t, y, k1, h, yNew, k7, options, &dense);
+        if (error > 1.0) {
+            h = detail::nextStep(h, error);
+            if (h < 1e-15 * std::max(1.0, std::abs(t))) {
+                return false;
+            }
+            continue;
+        }
+
+        const double tNew = t + h;
+        const double gNew = g(tNew, yNew);
+        if (gPrev != 0.0 && (gNew == 0.0 || (gNew < 0.0) != (gPrev < 0.0))) {
+            const double root = detail::refineRoot(g, dense, t, gPrev, tNew, gNew);
+            y = root == tNew ? yNew : dense(root);
+            t = root;
+            if (stepSize) {
+                *stepSize = detail::nextStep(h, error);
+            }
+            return true;
+        }
+
+        t = tNew;
+        y = yNew;
+        k1 = k7;
+        gPrev = gNew;
+        h = detail::nextStep(h, error);
+    }
+    return false;
+}
+
+} // namespace hohmann
+
+#endif // HOHMANN_ODE_HPP
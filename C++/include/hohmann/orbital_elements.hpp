@@ -0,0 +1,144 @@
+#ifndef HOHMANN_ORBITAL_ELEMENTS_HPP
+#define HOHMANN_ORBITAL_ELEMENTS_HPP
+
+/*
+ * orbital_elements.hpp - Keplerian elements, Cartesian state vectors and
+ * the conversions between them (single-object and structure-of-arrays forms)
+ */
+
+#include "orbit.hpp"
+#include "vector3.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * KeplerianElements struct - Classical orbital elements of a two-body orbit
+ *
+ * Angles are in radians. Singular geometries use these conventions:
+ *   - Circular (e = 0): argumentOfPeriapsis = 0, trueAnomaly holds the
+ *     argument of latitude (angle from the ascending node)
+ *   - Equatorial (i = 0 or pi): raan = 0, argumentOfPeriapsis holds the
+ *     longitude of periapsis (angle from the +x axis)
+ *   - Circular equatorial: both are 0, trueAnomaly holds the true longitude
+ *
+ * Hyperbolic orbits use a negative semi-major axis. Parabolic orbits
+ * (e = 1 exactly) are not representable with a semi-major axis.
+ */
+struct KeplerianElements {
+    double semiMajorAxis = 0.0;       ///< a [m]
+    double eccentricity = 0.0;        ///< e [-]
+    double inclination = 0.0;         ///< i [rad]
+    double raan = 0.0;                ///< Right ascension of ascending node [rad]
+    double argumentOfPeriapsis = 0.0; ///< omega [rad]
+    double trueAnomaly = 0.0;         ///< nu [rad]
+
+    // Derived values
+    [[nodiscard]] double semiLatusRectum() const {
+        return semiMajorAxis * (1.0 - eccentricity * eccentricity);
+    }
+    [[nodiscard]] double periapsisRadius() const { return semiMajorAxis * (1.0 - eccentricity); }
+    [[nodiscard]] double apoapsisRadius() const { return semiMajorAxis * (1.0 + eccentricity); }
+
+    /*
+     * Elements of a circular Orbit, optionally placed in an inclined plane
+     *
+     * Parameters:
+     *   orbit - Circular orbit supplying the radius
+     *   inclination - Orbit inclination [rad]
+     *   raan - Right ascension of the ascending node [rad]
+     *   argumentOfLatitude - Position along the orbit from the node [rad]
+     */
+    static KeplerianElements fromOrbit(const Orbit& orbit, double inclination = 0.0,
+                                       double raan = 0.0, double argumentOfLatitude = 0.0);
+};
+
+/*
+ * StateVector struct - Inertial position and velocity of an orbiting object
+ */
+struct StateVector {
+    Vec3 position;  ///< [m]
+    Vec3 velocity;  ///< [m/s]
+};
+
+/*
+ * KeplerianElementsArray struct - Structure-of-arrays catalogue of elements
+ *
+ * Each column is contiguous so batch conversions stream through memory and
+ * the compiler can vectorize the trigonometry-free parts of the kernels.
+ */
+struct KeplerianElementsArray {
+    std::vector<double> semiMajorAxis;        ///< [m]
+    std::vector<double> eccentricity;         ///< [-]
+    std::vector<double> inclination;          ///< [rad]
+    std::vector<double> raan;                 ///< [rad]
+    std::vector<double> argumentOfPeriapsis;  ///< [rad]
+    std::vector<double> trueAnomaly;          ///< [rad]
+
+    [[nodiscard]] std::size_t size() const { return semiMajorAxis.size(); }
+    void resize(std::size_t count);
+
+    [[nodiscard]] KeplerianElements at(std::size_t index) const;
+    void set(std::size_t index, const KeplerianElements& elements);
+};
+
+/*
+ * StateVectorArray struct - Structure-of-arrays catalogue of Cartesian states
+ */
+struct StateVectorArray {
+    std::vector<double> x, y, z;     ///< Position components [m]
+    std::vector<double> vx, vy, vz;  ///< Velocity components [m/s]
+
+    [[nodiscard]] std::size_t size() const { return x.size(); }
+    void resize(std::size_t count);
+
+    [[nodiscard]] StateVector at(std::size_t index) const;
+    void set(std::size_t index, const StateVector& state);
+};
+
+/*
+ * Convert Keplerian elements to an inertial state vector
+ *
+ * Parameters:
+ *   elements - Orbital elements (see KeplerianElements for conventions)
+ *   mu - Gravitational parameter of the central body [m³/s²]
+ *
+ * Returns:
+ *   Position and velocity in the inertial frame
+ */
+[[nodiscard]] StateVector keplerianToCartesian(const KeplerianElements& elements, double mu);
+
+/*
+ * Convert an inertial state vector to Keplerian elements
+ *
+ * Parameters:
+ *   state - Position and velocity in the inertial frame
+ *   mu - Gravitational parameter of the central body [m³/s²]
+ *
+ * Returns:
+ *   Orbital elements, with singular angles resolved per KeplerianElements
+ */
+[[nodiscard]] KeplerianElements cartesianToKeplerian(const StateVector& state, double mu);
+
+/*
+ * Batch conversions over a whole catalogue
+ *
+ * The output is resized to match the input; when it is already the right
+ * size (the common case when converting repeatedly into the same buffers)
+ * no memory is allocated.
+ *
+ * Parameters:
+ *   elements / states - Input catalogue
+ *   mu - Gravitational parameter of the central body [m³/s²]
+ *   states / elements - Output catalogue
+ */
+void keplerianToCartesian(const KeplerianElementsArray& elements, double mu,
+                          StateVectorArray& states);
+void cartesianToKeplerian(const StateVectorArray& states, double mu,
+                          KeplerianElementsArray& elements);
+
+} // namespace hohmann
+
+#endif // HOHMANN_ORBITAL_ELEMENTS_HPP
@@ -0,0 +1,45 @@
+#ifndef HOHMANN_PARETO_HPP
+#define HOHMANN_PARETO_HPP
+
+/*
+ * pareto.hpp - Non-dominated (Pareto-front) extraction for two-objective
+ * trade studies such as delta-v vs time of flight
+ */
+
+#include "transfer_batch.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * Indices of the points not dominated in (cost, time)
+ *
+ * Both objectives are minimized. A point is dominated if another point is
+ * no worse in both and strictly better in one. Exact duplicates keep only
+ * the lowest index. NaN entries are ignored.
+ *
+ * Large inputs are split into chunks whose local fronts are found in
+ * parallel (sort + sweep, O(n log n)) and then merged pairwise in a
+ * divide-and-conquer tree. Only indices are returned; no column is copied.
+ *
+ * Parameters:
+ *   cost - First objective, `count` entries (e.g. totalDeltaV) [any unit]
+ *   time - Second objective, `count` entries (e.g. transferTime) [any unit]
+ *   count - Number of points
+ *
+ * Returns:
+ *   Front indices ordered by increasing time (hence decreasing cost)
+ */
+[[nodiscard]] std::vector<std::size_t> paretoFront(const double* cost, const double* time,
+                                                   std::size_t count);
+
+/*
+ * Pareto front of totalDeltaV vs transferTime for sweep/batch results
+ */
+[[nodiscard]] std::vector<std::size_t> paretoFront(const TransferColumns& columns);
+
+} // namespace hohmann
+
+#endif // HOHMANN_PARETO_HPP
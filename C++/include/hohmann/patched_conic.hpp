@@ -0,0 +1,148 @@
+#ifndef HOHMANN_PATCHED_CONIC_HPP
+#define HOHMANN_PATCHED_CONIC_HPP
+
+/*
+ * patched_conic.hpp - Patched-conic interplanetary missions: hyperbolic
+ * departure from a parking orbit and capture at the destination planet
+ */
+
+#include "hohmann_transfer.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * CaptureOrbit struct - Target orbit at the arrival planet
+ *
+ * Capture burns happen at periapsis, so the orbit is described by its
+ * periapsis radius and eccentricity (0 = circular, close to 1 = loosely
+ * captured ellipse).
+ */
+struct CaptureOrbit {
+    double periapsisRadius;  ///< [m], from the planet's center
+    double eccentricity;     ///< [-], 0 <= e < 1
+};
+
+/*
+ * MissionDeltaVTable struct - Full mission delta-v over parking x capture orbits
+ *
+ * Departure cost depends only on the parking orbit and capture cost only on
+ * the capture orbit, so those are stored once per row/column and the total
+ * is expanded row-major: totalDeltaV[i * captureCount() + j].
+ */
+struct MissionDeltaVTable {
+    std::vector<double> parkingRadius;     ///< [m], one per row
+    std::vector<CaptureOrbit> captureOrbit; ///< One per column
+    std::vector<double> departureDeltaV;   ///< [m/s], one per row
+    std::vector<double> captureDeltaV;     ///< [m/s], one per column
+    std::vector<double> totalDeltaV;       ///< [m/s], rows x columns
+    double heliocentricTransferTime = 0.0; ///< [s], same for every entry
+
+    [[nodiscard]] std::size_t parkingCount() const { return parkingRadius.size(); }
+    [[nodiscard]] std::size_t captureCount() const { return captureOrbit.size(); }
+    [[nodiscard]] double total(std::size_t row, std::size_t column) const {
+        return totalDeltaV[row * captureCount() + column];
+    }
+};
+
+/*
+ * PatchedConicMission class - Two-planet mission stitched from three conics
+ *
+ * The heliocentric HohmannTransfer between the planets' orbits gives the
+ * hyperbolic excess speed (v-infinity) on leaving the departure planet and on
+ * reaching the arrival planet. Inside each planet's sphere of influence the
+ * spacecraft flies a hyperbola with that v-infinity, and the burns are
+ * applied at the hyperbola's periapsis.
+ */
+class PatchedConicMission {
+public:
+    /*
+     * Construct a mission from a heliocentric transfer
+     *
+     * Parameters:
+     *   heliocentric - Transfer between the two planets' solar orbits
+     *   departureBody - Planet the parking orbit circles (e.g. Earth())
+     *   arrivalBody - Planet to be captured at (e.g. Mars())
+     *
+     * Throws:
+     *   std::invalid_argument if either planet is the transfer's central body
+     */
+    PatchedConicMission(const HohmannTransfer& heliocentric,
+                        const CelestialBody& departureBody,
+                        const CelestialBody& arrivalBody);
+
+    // Accessors
+    [[nodiscard]] const HohmannTransfer& heliocentricTransfer() const { return m_transfer; }
+    [[nodiscard]] const CelestialBody& departureBody() const { return m_departureBody; }
+    [[nodiscard]] const CelestialBody& arrivalBody() const { return m_arrivalBody; }
+    [[nodiscard]] double departureVInfinity() const { return m_transfer.result().deltaV1; }
+    [[nodiscard]] double arrivalVInfinity() const { return m_transfer.result().deltaV2; }
+
+    /*
+     * Delta-v to leave a circular parking orbit on the departure hyperbola
+     *
+     * Throws:
+     *   std::invalid_argument if parking is not around the departure body
+     */
+    [[nodiscard]] double departureDeltaV(const Orbit& parking) const;
+
+    /*
+     * Delta-v to capture from the arrival hyperbola into the given orbit
+     *
+     * Throws:
+     *   std::invalid_argument for a non-positive periapsis radius, e outside
+     *   [0, 1), or a periapsis below the arrival body's surface
+     */
+    [[nodiscard]] double captureDeltaV(const CaptureOrbit& capture) const;
+
+    /*
+     * Delta-v to capture into a circular orbit
+     *
+     * Throws:
+     *   std::invalid_argument if target is not around the arrival body
+     */
+    [[nodiscard]] double captureDeltaV(const Orbit& target) const;
+
+    /*
+     * Full mission table over many parking radii and capture orbits
+     *
+     * Parameters:
+     *   parkingRadii - Circular parking orbit radii at departure [m]
+     *   captureOrbits - Capture orbits at arrival
+     *
+     * Returns:
+     *   Table of departure, capture and total delta-v
+     *
+     * Throws:
+     *   std::invalid_argument for non-positive radii, or capture orbits
+     *   rejected by captureDeltaV()
+     */
+    [[nodiscard]] MissionDeltaVTable deltaVTable(const std::vector<double>& parkingRadii,
+                                                 const std::vector<CaptureOrbit>& captureOrbits) const;
+
+private:
+    HohmannTransfer m_transfer;
+    CelestialBody m_departureBody;
+    CelestialBody m_arrivalBody;
+};
+
+/*
+ * Periapsis burn between a hyperbola and a bound orbit
+ *
+ * Parameters:
+ *   vInfinity - Hyperbolic excess speed [m/s]
+ *   mu - Planet gravitational parameter [m³/s²]
+ *   periapsisRadius - Burn radius [m]
+ *   eccentricity - Eccentricity of the bound orbit (0 = circular)
+ *
+ * Returns:
+ *   Burn magnitude [m/s]
+ */
+[[nodiscard]] double hyperbolicPeriapsisDeltaV(double vInfinity, double mu,
+                                               double periapsisRadius, double eccentricity);
+
+} // namespace hohmann
+
+#endif // HOHMANN_PATCHED_CONIC_HPP
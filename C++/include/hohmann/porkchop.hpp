@@ -0,0 +1,82 @@
+#ifndef HOHMANN_PORKCHOP_HPP
+#define HOHMANN_PORKCHOP_HPP
+
+/*
+ * porkchop.hpp - Launch-date x time-of-flight Lambert grids ("porkchop plots")
+ */
+
+#include "ephemeris.hpp"
+#include "top_k.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * PorkchopColumns struct - One entry per (departure epoch, time of flight)
+ *
+ * Row-major: index = i * timesOfFlight.size() + j. Cases where the Lambert
+ * solver finds no arc hold NaN excess speeds.
+ */
+struct PorkchopColumns {
+    std::vector<double> departureEpoch;      ///< [s past J2000]
+    std::vector<double> timeOfFlight;        ///< [s]
+    std::vector<double> departureVInfinity;  ///< [m/s]
+    std::vector<double> arrivalVInfinity;    ///< [m/s]
+    std::vector<double> totalVInfinity;      ///< departure + arrival [m/s]
+
+    [[nodiscard]] std::size_t size() const { return totalVInfinity.size(); }
+    void resize(std::size_t count);
+};
+
+/*
+ * PorkchopMetric enum - Which excess speed to rank by
+ */
+enum class PorkchopMetric : unsigned char {
+    DepartureVInfinity,
+    ArrivalVInfinity,
+    TotalVInfinity
+};
+
+/*
+ * PorkchopCase struct - One of the k best porkchop cases
+ */
+struct PorkchopCase {
+    std::size_t index;            ///< Row-major grid index
+    double departureEpoch;        ///< [s past J2000]
+    double timeOfFlight;          ///< [s]
+    double departureVInfinity;    ///< [m/s]
+    double arrivalVInfinity;      ///< [m/s]
+};
+
+/*
+ * Solve Lambert's problem for every (departure epoch, time of flight) pair
+ *
+ * Parameters:
+ *   departure, arrival - Planets at either end
+ *   departureEpochs - Launch dates, one per row [s past J2000]
+ *   timesOfFlight - Durations, one per column [s]
+ *
+ * Throws:
+ *   std::invalid_argument if any time of flight is not positive
+ */
+[[nodiscard]] PorkchopColumns computePorkchop(const PlanetEphemeris& departure,
+                                              const PlanetEphemeris& arrival,
+                                              const std::vector<double>& departureEpochs,
+                                              const std::vector<double>& timesOfFlight);
+
+/*
+ * The k best porkchop cases, without storing the grid
+ *
+ * Per-chunk TopKReducers are merged at the end (memory O(k x threads)).
+ * Cases with no Lambert solution are skipped. Ties go to the lower index.
+ */
+[[nodiscard]] std::vector<PorkchopCase> porkchopTopK(
+    const PlanetEphemeris& departure, const PlanetEphemeris& arrival,
+    const std::vector<double>& departureEpochs, const std::vector<double>& timesOfFlight,
+    std::size_t k, PorkchopMetric metric = PorkchopMetric::TotalVInfinity);
+
+} // namespace hohmann
+
+#endif // HOHMANN_PORKCHOP_HPP
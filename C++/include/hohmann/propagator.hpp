@@ -0,0 +1,196 @@
+#ifndef HOHMANN_PROPAGATOR_HPP
+#define HOHMANN_PROPAGATOR_HPP
+
+/*
+ * propagator.hpp - Numerical two-body (+ J2) propagation with event
+ * detection, for a single state or a whole catalogue
+ */
+
+#include "celestial_body.hpp"
+#include "ode.hpp"
+#include "orbital_elements.hpp"
+#include "scheduler.hpp"
+#include "vector3.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * OrbitState - Inertial state {x, y, z, vx, vy, vz} [m, m/s]
+ */
+using OrbitState = OdeState<6>;
+
+/*
+ * GravityModel struct - Central-body gravity: point mass plus optional J2
+ */
+struct GravityModel {
+    double mu = 0.0;                 ///< [m³/s²]
+    double j2 = 0.0;                 ///< Second zonal harmonic [-]
+    double equatorialRadius = 0.0;   ///< Reference radius of j2 [m]
+
+    /* Point-mass gravity of a body */
+    static GravityModel pointMass(const CelestialBody& body) { return {body.gm(), 0.0, 0.0}; }
+
+    /* Earth with its J2 oblateness */
+    static GravityModel EarthJ2();
+
+    /* Equations of motion: dydt = f(y) */
+    void derivative(const OrbitState& y, OrbitState& dydt) const {
+        const double r2 = y[0] * y[0] + y[1] * y[1] + y[2] * y[2];
+        const double r = std::sqrt(r2);
+        const double k = -mu / (r2 * r);
+        double kxy = k, kz = k;
+        if (j2 != 0.0) {
+            const double p = 1.5 * j2 * equatorialRadius * equatorialRadius / r2;
+            const double z2 = 5.0 * y[2] * y[2] / r2;
+            kxy *= 1.0 + p * (1.0 - z2);
+            kz *= 1.0 + p * (3.0 - z2);
+        }
+        dydt[0] = y[3];
+        dydt[1] = y[4];
+        dydt[2] = y[5];
+        dydt[3] = kxy * y[0];
+        dydt[4] = kxy * y[1];
+        dydt[5] = kz * y[2];
+    }
+};
+
+/*
+ * EventFunction struct - A user-registered scalar switching function
+ *
+ * An event fires where g(t, state) changes sign between two integrator
+ * steps and the sign change matches `direction`; its time is then refined
+ * on the step's dense output, so locating it costs no extra force
+ * evaluations. A terminal event stops the propagation at the event.
+ *
+ * g is called concurrently from worker threads by the batch propagator, so
+ * it must not mutate shared state.
+ */
+struct EventFunction {
+    std::function<double(double t, const OrbitState& state)> g;
+    CrossingDirection direction = CrossingDirection::Any;
+    bool terminal = false;
+};
+
+/* Apsis: g = r . v; Increasing fires at periapsis, Decreasing at apoapsis */
+[[nodiscard]] EventFunction apsisEvent(CrossingDirection direction = CrossingDirection::Any);
+
+/* Equator crossing: g = z; Increasing fires at the ascending node */
+[[nodiscard]] EventFunction nodeEvent(CrossingDirection direction = CrossingDirection::Any);
+
+/*
+ * Altitude crossing: g = |r| - (bodyRadius + altitude)
+ *
+ * The default (descending, terminal) stops a propagation at re-entry.
+ */
+[[nodiscard]] EventFunction altitudeEvent(double bodyRadius, double altitude,
+                                          CrossingDirection direction = CrossingDirection::Decreasing,
+                                          bool terminal = true);
+
+/*
+ * Cylindrical-shadow eclipse with a fixed Sun direction
+ *
+ * g is the distance from the shadow cylinder's surface (negative inside),
+ * so Decreasing fires at eclipse entry and Increasing at exit.
+ *
+ * Throws:
+ *   std::invalid_argument if sunDirection is zero or bodyRadius is not positive
+ */
+[[nodiscard]] EventFunction eclipseEvent(const Vec3& sunDirection, double bodyRadius,
+                                         CrossingDirection direction = CrossingDirection::Any);
+
+/*
+ * EventRecord struct - One detected event
+ */
+struct EventRecord {
+    std::size_t event;    ///< Index into the registered event list
+    double time;          ///< [s] from the start of the propagation
+    OrbitState state;
+    bool increasing;      ///< Sign change of g was - to +
+};
+
+enum class PropagationStatus : std::uint8_t {
+    Completed,    ///< Reached the requested duration
+    Terminated,   ///< Stopped at a terminal event
+    Failed        ///< Integrator gave up (step underflow or maxSteps)
+};
+
+/*
+ * PropagationResult struct - Final state and the events found on the way
+ */
+struct PropagationResult {
+    PropagationStatus status = PropagationStatus::Completed;
+    double time = 0.0;       ///< Time reached [s]
+    OrbitState state{};      ///< State at `time`
+    std::vector<EventRecord> events;   ///< In time order
+};
+
+/*
+ * Propagate one state for `duration` seconds, collecting events
+ *
+ * Throws:
+ *   std::invalid_argument if duration is not positive, an event has no
+ *   function, or more than 65535 events are registered
+ */
+[[nodiscard]] PropagationResult propagateWithEvents(const GravityModel& model, const OrbitState& state,
+                                                    double duration,
+                                                    const std::vector<EventFunction>& events,
+                                                    const OdeOptions& options = {});
+
+/*
+ * EventColumns struct - Columnar log of events from a batch propagation
+ *
+ * Rows are ordered by lane, then by time.
+ */
+struct EventColumns {
+    std::vector<std::uint32_t> lane;
+    std::vector<std::uint16_t> event;
+    std::vector<std::uint8_t> increasing;
+    std::vector<double> time;
+    std::vector<double> x, y, z;
+    std::vector<double> vx, vy, vz;
+
+    [[nodiscard]] std::size_t size() const { return lane.size(); }
+    void resize(std::size_t count);
+
+    [[nodiscard]] OrbitState state(std::size_t index) const {
+        return {x[index], y[index], z[index], vx[index], vy[index], vz[index]};
+    }
+};
+
+/*
+ * BatchPropagation struct - Per-lane outcome plus the shared event log
+ */
+struct BatchPropagation {
+    StateVectorArray finalStates;
+    std::vector<double> finalTime;             ///< [s]
+    std::vector<PropagationStatus> status;
+    EventColumns events;
+};
+
+/*
+ * Propagate every state of a catalogue with the same event list
+ *
+ * Each lane runs its own adaptive integrator and keeps its own event queue,
+ * so lanes proceed in parallel on the shared scheduler without ever
+ * synchronizing; the logs are concatenated in lane order at the end.
+ *
+ * Parameters:
+ *   out - Resized to the catalogue; reused buffers are not reallocated
+ *   token - Optional; lanes not yet started are left with status Failed
+ *
+ * Throws:
+ *   std::invalid_argument as propagateWithEvents()
+ */
+void propagateWithEventsBatch(const GravityModel& model, const StateVectorArray& initial, double duration,
+                              const std::vector<EventFunction>& events, BatchPropagation& out,
+                              const OdeOptions& options = {}, const CancellationToken* token = nullptr);
+
+} // namespace hohmann
+
+#endif // HOHMANN_PROPAGATOR_HPP
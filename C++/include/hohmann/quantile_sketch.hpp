@@ -0,0 +1,88 @@
+#ifndef HOHMANN_QUANTILE_SKETCH_HPP
+#define HOHMANN_QUANTILE_SKETCH_HPP
+
+/*
+ * quantile_sketch.hpp - Mergeable streaming quantile estimator with a
+ * relative-error guarantee (DDSketch-style logarithmic buckets)
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * QuantileSketch class - Percentiles of a stream without storing it
+ *
+ * Values are counted in buckets whose edges grow geometrically by
+ * gamma = (1 + a) / (1 - a), so every reported quantile is within a
+ * relative error `a` of the true sample quantile. Memory grows with
+ * log(max / min), not with the number of samples: a million delta-v values
+ * between 1 m/s and 100 km/s need about 1,200 buckets at a = 0.5%.
+ *
+ * Merging adds bucket counts, which is exact and order-independent, so
+ * per-thread sketches combine into the same result however work was split.
+ */
+class QuantileSketch {
+public:
+    /*
+     * Parameters:
+     *   relativeAccuracy - Target relative error a, in (0, 1)
+     *
+     * Throws:
+     *   std::invalid_argument if relativeAccuracy is outside (0, 1)
+     */
+    explicit QuantileSketch(double relativeAccuracy = 0.005);
+
+    /*
+     * Record one value
+     *
+     * Throws:
+     *   std::invalid_argument for negative, infinite or NaN values
+     */
+    void add(double value);
+
+    /*
+     * Fold another sketch's counts into this one
+     *
+     * Throws:
+     *   std::invalid_argument if the sketches use different accuracies
+     */
+    void merge(const QuantileSketch& other);
+
+    /*
+     * Estimated q-quantile (q = 0.5 is the median)
+     *
+     * Throws:
+     *   std::invalid_argument if q is outside [0, 1]
+     *   std::logic_error if the sketch is empty
+     */
+    [[nodiscard]] double quantile(double q) const;
+
+    // Accessors
+    [[nodiscard]] std::uint64_t count() const { return m_count; }
+    [[nodiscard]] bool empty() const { return m_count == 0; }
+    [[nodiscard]] double min() const { return m_min; }
+    [[nodiscard]] double max() const { return m_max; }
+    [[nodiscard]] double relativeAccuracy() const { return m_accuracy; }
+    [[nodiscard]] std::size_t bucketCount() const { return m_buckets.size(); }
+
+private:
+    [[nodiscard]] int bucketIndex(double value) const;
+    void addToBucket(int index, std::uint64_t count);
+
+    double m_accuracy;
+    double m_gamma;
+    double m_logGamma;
+    std::vector<std::uint64_t> m_buckets;  // m_buckets[i] counts index m_offset + i
+    int m_offset = 0;
+    std::uint64_t m_zeroCount = 0;         // Values too small to bucket
+    std::uint64_t m_count = 0;
+    double m_min;
+    double m_max;
+};
+
+} // namespace hohmann
+
+#endif // HOHMANN_QUANTILE_SKETCH_HPP
@@ -0,0 +1,156 @@
+#ifndef HOHMANN_QUERY_SERVER_HPP
+#define HOHMANN_QUERY_SERVER_HPP
+
+/*
+ * query_server.hpp - Long-running transfer query service behind hohmannd:
+ * a single-threaded epoll loop on a Unix-domain socket and, optionally, a
+ * localhost TCP port (Linux only)
+ *
+ * Line protocol, one request per line, one response per request in
+ * request order (radii in m, mu in m³/s², Earth's if omitted):
+ *
+ *   PING                                  -> OK PONG
+ *   TRANSFER r1 r2 [mu]                   -> OK dv1 dv2 totalDv time sma
+ *   SWEEP r1min r1max n1 r2min r2max n2 [k] [mu]
+ *                                         -> OK k, then k lines
+ *                                            "index r1 r2 totalDv time"
+ *   STATS                                 -> OK n, then n lines of
+ *                                            latency percentiles [us]
+ *   QUIT                                  -> OK BYE, then close
+ *
+ * Failures answer "ERR <reason>"; only an overlong line also closes the
+ * connection. The last line before the client shuts down its side may
+ * omit the newline.
+ */
+
+#include "quantile_sketch.hpp"
+#include "transfer_batch.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * QueryServerOptions struct - Endpoints and request limits
+ */
+struct QueryServerOptions {
+    std::string socketPath = "/tmp/hohmannd.sock";  ///< Empty disables the Unix socket
+    int tcpPort = -1;                       ///< 127.0.0.1 only; -1 disables, 0 picks a free port
+    std::size_t maxBatch = 4096;            ///< Requests parsed per wakeup; the rest wait in the socket
+    std::size_t maxLineLength = 4096;       ///< Longer lines get ERR and the connection is closed
+    std::size_t maxSweepCells = 1u << 24;   ///< Largest n1 * n2 a SWEEP may request
+    std::size_t maxSweepK = 10000;          ///< Largest k a SWEEP may request
+};
+
+/*
+ * QueryServer class - Event loop answering transfer queries
+ *
+ * Every TRANSFER line that arrives during one epoll wakeup - from any
+ * connection, pipelined or not - is gathered into columns and evaluated
+ * by one calculateTransferBatch() call per mu, so a burst of concurrent
+ * clients costs one vectorized kernel pass instead of one call each.
+ * Reading stops once maxBatch requests are waiting, which bounds how long
+ * the first request of a large burst waits for the last.
+ * SWEEP runs sweepTransfersTopK() on the shared scheduler while the loop
+ * waits.
+ *
+ * Latency is measured per request from the read that delivered its line
+ * to its response being queued, and kept per command in a QuantileSketch.
+ */
+class QueryServer {
+public:
+    /*
+     * Open and bind the listening sockets
+     *
+     * A stale socket file at socketPath is replaced; any other file there
+     * is left alone.
+     *
+     * Throws:
+     *   std::invalid_argument if no endpoint is enabled, the path is too
+     *   long or names a non-socket file
+     *   std::system_error if a socket call fails
+     */
+    explicit QueryServer(const QueryServerOptions& options = {});
+    ~QueryServer();
+
+    QueryServer(const QueryServer&) = delete;
+    QueryServer& operator=(const QueryServer&) = delete;
+
+    /*
+     * Serve until stop() is called
+     *
+     * Throws:
+     *   std::system_error if epoll itself fails
+     */
+    void run();
+
+    /* Make run() return; callable from any thread or a signal handler */
+    void stop();
+
+    /* Bound TCP port (useful with tcpPort = 0), or -1 */
+    [[nodiscard]] int tcpPort() const { return m_tcpPort; }
+
+    /* Latency percentiles per command and batch totals, one line each;
+       call while run() is not executing */
+    [[nodiscard]] std::string statistics() const;
+
+private:
+    enum Command : unsigned char { Transfer, Sweep, Stats, Ping, Quit, Other, CommandCount };
+
+    struct Connection;
+
+    // A parsed request awaiting its response
+    struct Pending {
+        Connection* connection;
+        Command command;         // Latency bucket
+        std::int64_t received;   // Steady-clock time [ns]
+        std::string response;    // Filled at parse time unless batched or STATS
+        bool batched = false;    // TRANSFER waiting on group / slot
+        std::size_t group = 0;
+        std::size_t slot = 0;
+    };
+
+    // TRANSFER requests sharing one mu in the current wakeup
+    struct BatchGroup {
+        double mu;
+        std::vector<double> r1;
+        std::vector<double> r2;
+        TransferColumns out;
+    };
+
+    void acceptAll(int listener);
+    void readFrom(Connection& connection);
+    void handleLine(Connection& connection, const std::string& line, std::int64_t received);
+    void runBatches();
+    void flush(Connection& connection);
+    void closeConnection(int fd);
+    void closeAll();
+
+    QueryServerOptions m_options;
+    int m_epoll = -1;
+    int m_wake = -1;            // eventfd written by stop()
+    int m_unixListener = -1;
+    int m_tcpListener = -1;
+    int m_tcpPort = -1;
+    bool m_boundPath = false;   // We created the socket file and must remove it
+
+    std::unordered_map<int, std::unique_ptr<Connection>> m_connections;
+    std::vector<Pending> m_pending;
+    std::vector<BatchGroup> m_groups;
+    std::size_t m_groupCount = 0;
+
+    std::array<QuantileSketch, CommandCount> m_latency;
+    std::uint64_t m_batches = 0;
+    std::uint64_t m_batchedTransfers = 0;
+    std::size_t m_largestBatch = 0;
+};
+
+} // namespace hohmann
+
+#endif // HOHMANN_QUERY_SERVER_HPP
@@ -0,0 +1,76 @@
+#ifndef HOHMANN_RANDOM_HPP
+#define HOHMANN_RANDOM_HPP
+
+/*
+ * random.hpp - Counter-based random numbers (Philox4x32-10)
+ *
+ * A counter-based generator has no hidden state: random block number n is a
+ * pure function of (key, n). Any thread can produce sample i's numbers
+ * directly, so parallel Monte Carlo runs give bit-identical results no
+ * matter how the work is split. Reference: Salmon et al., "Parallel Random
+ * Numbers: As Easy as 1, 2, 3" (SC11).
+ */
+
+#include "constants.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace hohmann {
+
+/*
+ * Philox4x32 class - Ten-round Philox bijection on 128-bit counters
+ */
+class Philox4x32 {
+public:
+    using Block = std::array<std::uint32_t, 4>;
+
+    explicit Philox4x32(std::uint64_t seed)
+        : m_key{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)} {}
+
+    /* Four independent 32-bit random words for `counter` */
+    [[nodiscard]] Block operator()(Block counter) const {
+        std::array<std::uint32_t, 2> key = m_key;
+        for (int round = 0; round < 10; ++round) {
+            std::uint64_t p0 = std::uint64_t{0xD2511F53u} * counter[0];
+            std::uint64_t p1 = std::uint64_t{0xCD9E8D57u} * counter[2];
+            counter = {static_cast<std::uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+                       static_cast<std::uint32_t>(p1),
+                       static_cast<std::uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+                       static_cast<std::uint32_t>(p0)};
+            key[0] += 0x9E3779B9u;
+            key[1] += 0xBB67AE85u;
+        }
+        return counter;
+    }
+
+    /* Words for (stream, draw): stream is typically the sample index */
+    [[nodiscard]] Block operator()(std::uint64_t stream, std::uint32_t draw) const {
+        return (*this)(Block{static_cast<std::uint32_t>(stream),
+                             static_cast<std::uint32_t>(stream >> 32), draw, 0u});
+    }
+
+private:
+    std::array<std::uint32_t, 2> m_key;
+};
+
+/*
+ * Map a 32-bit word to the open interval (0, 1)
+ */
+[[nodiscard]] inline double uniformOpen(std::uint32_t word) {
+    return (static_cast<double>(word) + 0.5) * (1.0 / 4294967296.0);
+}
+
+/*
+ * Box-Muller: two words -> two independent standard normal deviates
+ */
+[[nodiscard]] inline std::array<double, 2> standardNormalPair(std::uint32_t a, std::uint32_t b) {
+    double radius = std::sqrt(-2.0 * std::log(uniformOpen(a)));
+    double angle = math::twoPi * uniformOpen(b);
+    return {radius * std::cos(angle), radius * std::sin(angle)};
+}
+
+} // namespace hohmann
+
+#endif // HOHMANN_RANDOM_HPP
@@ -0,0 +1,91 @@
+#ifndef HOHMANN_REACHABILITY_HPP
+#define HOHMANN_REACHABILITY_HPP
+
+/*
+ * reachability.hpp - Inverse Hohmann query: which circular orbits can a
+ * spacecraft reach with the delta-v it has left?
+ */
+
+#include "orbit.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * ReachableRadii struct - Final radii reachable by one Hohmann transfer
+ *
+ * Hohmann delta-v is not monotonic in the final radius: it peaks at
+ * r2/r1 ~ 15.58 (0.536 v1) and falls back toward (sqrt(2) - 1) v1 for very
+ * distant targets. A budget between those two values therefore reaches a
+ * band around the current orbit AND every orbit beyond a distant threshold:
+ *
+ *   reachable = [minimumRadius, maximumRadius]  U  [distantRadius, infinity)
+ *
+ * maximumRadius and distantRadius are +infinity when not bounded / not
+ * applicable.
+ */
+struct ReachableRadii {
+    double minimumRadius;   ///< [m]
+    double maximumRadius;   ///< [m], +inf if unbounded
+    double distantRadius;   ///< [m], +inf if there is no distant band
+
+    [[nodiscard]] bool contains(double radius) const {
+        return (radius >= minimumRadius && radius <= maximumRadius) || radius >= distantRadius;
+    }
+};
+
+/*
+ * Radii reachable from a circular orbit with a delta-v budget
+ *
+ * Parameters:
+ *   orbit - Current circular orbit
+ *   deltaVBudget - Remaining delta-v [m/s]
+ *
+ * Returns:
+ *   Reachable radii; the lower bound never goes below the body's surface
+ *   radius when the body has one
+ *
+ * Throws:
+ *   std::invalid_argument if deltaVBudget is negative or NaN
+ */
+[[nodiscard]] ReachableRadii reachableRadii(const Orbit& orbit, double deltaVBudget);
+
+/*
+ * ReachabilityColumns struct - Structure-of-arrays ReachableRadii for fleets
+ */
+struct ReachabilityColumns {
+    std::vector<double> minimumRadius;  ///< [m]
+    std::vector<double> maximumRadius;  ///< [m]
+    std::vector<double> distantRadius;  ///< [m]
+
+    [[nodiscard]] std::size_t size() const { return minimumRadius.size(); }
+    void resize(std::size_t count);
+
+    [[nodiscard]] ReachableRadii at(std::size_t index) const {
+        return {minimumRadius[index], maximumRadius[index], distantRadius[index]};
+    }
+};
+
+/*
+ * Reachable radii for a whole fleet around one body
+ *
+ * Parameters:
+ *   radii - Current circular orbit radius of each spacecraft [m]
+ *   budgets - Remaining delta-v of each spacecraft [m/s]
+ *   count - Number of spacecraft
+ *   mu - Gravitational parameter [m³/s²]
+ *   surfaceRadius - Floor for minimumRadius [m] (0 = none)
+ *   out - Output columns (resized to `count`)
+ *
+ * Throws:
+ *   std::invalid_argument if any radius is not positive or any budget is
+ *   negative (message names the spacecraft index)
+ */
+void reachableRadiiBatch(const double* radii, const double* budgets, std::size_t count,
+                         double mu, double surfaceRadius, ReachabilityColumns& out);
+
+} // namespace hohmann
+
+#endif // HOHMANN_REACHABILITY_HPP
@@ -0,0 +1,194 @@
+#ifndef HOHMANN_RELATIVE_MOTION_HPP
+#define HOHMANN_RELATIVE_MOTION_HPP
+
+/*
+ * relative_motion.hpp - Clohessy-Wiltshire (Hill) relative motion about a
+ * circular target orbit: closed-form propagation and two-impulse targeting
+ */
+
+#include "orbit.hpp"
+#include "vector3.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * RelativeState struct - Chaser position and velocity in the target's
+ * Hill (LVLH) frame
+ *
+ *   x - radial, away from the central body
+ *   y - along-track, in the direction of the target's motion
+ *   z - cross-track, along the target's orbit normal
+ */
+struct RelativeState {
+    Vec3 position;   ///< [m]
+    Vec3 velocity;   ///< [m/s]
+};
+
+/*
+ * CwTransition class - CW state-transition matrix for one (orbit, dt) pair
+ *
+ * Phi(dt) maps a relative state at t to the state at t + dt:
+ *
+ *   [ r ]   [ Phi_rr  Phi_rv ] [ r0 ]
+ *   [ v ] = [ Phi_vr  Phi_vv ] [ v0 ]
+ *
+ * Only the 20 non-zero entries are stored (the in-plane and cross-track
+ * motions decouple). Building one costs a sin and a cos; applying it costs
+ * 20 multiply-adds, so build once and apply it to every chaser.
+ *
+ * Valid while the separation is small compared with the orbit radius
+ * (linearized dynamics, circular target).
+ */
+class CwTransition {
+public:
+    /*
+     * Parameters:
+     *   meanMotion - Target's mean motion n = sqrt(mu / r³) [rad/s]
+     *   dt - Propagation time, may be negative [s]
+     *
+     * Throws:
+     *   std::invalid_argument if meanMotion is not positive
+     */
+    CwTransition(double meanMotion, double dt);
+    CwTransition(const Orbit& target, double dt);
+
+    [[nodiscard]] double meanMotion() const { return m_n; }
+    [[nodiscard]] double dt() const { return m_dt; }
+
+    [[nodiscard]] RelativeState apply(const RelativeState& s) const {
+        const Vec3& r = s.position;
+        const Vec3& v = s.velocity;
+        return {{m_xx * r.x + m_xvx * v.x + m_xvy * v.y,
+                 m_yx * r.x + r.y + m_yvx * v.x + m_yvy * v.y,
+                 m_c * r.z + m_zvz * v.z},
+                {m_vxx * r.x + m_c * v.x + m_vxvy * v.y,
+                 m_vyx * r.x + m_vyvx * v.x + m_vyvy * v.y,
+                 m_vzz * r.z + m_c * v.z}};
+    }
+
+    /*
+     * Velocity the chaser needs now to be at arrivalPosition after dt
+     *
+     * Solves Phi_rr r0 + Phi_rv v0 = r_f for v0 with the inverse of Phi_rv
+     * cached at construction. When the cross-track block is singular (dt a
+     * multiple of half a period) the cross-track position at dt is fixed;
+     * if it already matches, the current cross-track velocity is kept.
+     *
+     * Returns:
+     *   std::nullopt if no velocity reaches arrivalPosition at dt
+     */
+    [[nodiscard]] std::optional<Vec3> departureVelocity(const RelativeState& chaser,
+                                                        const Vec3& arrivalPosition) const;
+
+private:
+    double m_n, m_dt, m_c;
+    double m_xx, m_xvx, m_xvy;              // Phi_rr, Phi_rv row x
+    double m_yx, m_yvx, m_yvy;              // row y (Phi_rr[y][y] = 1)
+    double m_zvz;                           // row z (Phi_rr[z][z] = c)
+    double m_vxx, m_vxvy;                   // row vx (Phi_vv[x][x] = c)
+    double m_vyx, m_vyvx, m_vyvy;           // row vy
+    double m_vzz;                           // row vz (Phi_vv[z][z] = c)
+
+    // Inverse of the in-plane block of Phi_rv, and whether each block is invertible
+    double m_inv00, m_inv01, m_inv10, m_inv11;
+    bool m_inPlaneInvertible, m_crossTrackInvertible;
+};
+
+/*
+ * RelativeColumns struct - Structure-of-arrays RelativeState for chaser fleets
+ */
+struct RelativeColumns {
+    std::vector<double> x, y, z;       ///< [m]
+    std::vector<double> vx, vy, vz;    ///< [m/s]
+
+    [[nodiscard]] std::size_t size() const { return x.size(); }
+    void resize(std::size_t count);
+
+    [[nodiscard]] RelativeState at(std::size_t index) const {
+        return {{x[index], y[index], z[index]}, {vx[index], vy[index], vz[index]}};
+    }
+    void set(std::size_t index, const RelativeState& s);
+};
+
+/*
+ * Propagate every chaser by one transition
+ *
+ * Parameters:
+ *   stm - Transition for the target orbit and time step
+ *   in - Initial relative states
+ *   out - Propagated states (resized; may alias `in`)
+ */
+void propagateRelativeBatch(const CwTransition& stm, const RelativeColumns& in,
+                            RelativeColumns& out);
+
+/*
+ * Propagate every chaser to every time
+ *
+ * One transition is built per time and applied to all chasers. Results are
+ * row-major: index = t * chasers.size() + k.
+ *
+ * Parameters:
+ *   meanMotion - Target's mean motion [rad/s]
+ *   chasers - Relative states at t = 0
+ *   times - Output times [s]
+ *
+ * Throws:
+ *   std::invalid_argument if meanMotion is not positive
+ */
+[[nodiscard]] RelativeColumns propagateRelativeGrid(double meanMotion,
+                                                    const RelativeColumns& chasers,
+                                                    const std::vector<double>& times);
+
+/*
+ * TwoImpulseManeuver struct - Burns that take a chaser to a target state
+ */
+struct TwoImpulseManeuver {
+    Vec3 firstBurn;      ///< Applied at t = 0 [m/s]
+    Vec3 secondBurn;     ///< Applied at t = dt [m/s]
+    double totalDeltaV;  ///< |firstBurn| + |secondBurn| [m/s]
+};
+
+/*
+ * Two-impulse CW targeting
+ *
+ * The first burn puts the chaser on the arc that reaches `arrival.position`
+ * after stm.dt(): v0+ = Phi_rv^-1 (r_f - Phi_rr r0). The second burn matches
+ * `arrival.velocity` (zero for docking at a point fixed in the Hill frame).
+ *
+ * Returns:
+ *   std::nullopt if stm.dt() is not positive or Phi_rv is singular for this
+ *   time (e.g. a full in-plane period, or half a period with a cross-track
+ *   offset that cannot be removed)
+ */
+[[nodiscard]] std::optional<TwoImpulseManeuver> targetRendezvous(const CwTransition& stm,
+                                                                 const RelativeState& chaser,
+                                                                 const RelativeState& arrival);
+
+/*
+ * TargetingColumns struct - Structure-of-arrays TwoImpulseManeuver
+ *
+ * Cases with no solution hold NaN in every column.
+ */
+struct TargetingColumns {
+    std::vector<Vec3> firstBurn;        ///< [m/s]
+    std::vector<Vec3> secondBurn;       ///< [m/s]
+    std::vector<double> totalDeltaV;    ///< [m/s]
+
+    [[nodiscard]] std::size_t size() const { return totalDeltaV.size(); }
+    void resize(std::size_t count);
+};
+
+/*
+ * Two-impulse targeting for every chaser towards the same arrival state,
+ * all with the transfer time of `stm`
+ */
+void targetRendezvousBatch(const CwTransition& stm, const RelativeColumns& chasers,
+                           const RelativeState& arrival, TargetingColumns& out);
+
+} // namespace hohmann
+
+#endif // HOHMANN_RELATIVE_MOTION_HPP
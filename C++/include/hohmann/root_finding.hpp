@@ -0,0 +1,64 @@
+#ifndef HOHMANN_ROOT_FINDING_HPP
+#define HOHMANN_ROOT_FINDING_HPP
+
+/*
+ * root_finding.hpp - Bracketed scalar root finding shared by the event
+ * locators (ODE events, access rise / set, conjunction TCA)
+ */
+
+#include <cmath>
+
+namespace hohmann {
+
+/*
+ * Root of f on [lo, hi] by Illinois regula falsi
+ *
+ * Falls back to bisection when the secant point is not strictly inside the
+ * bracket (a noise-level f at one end pins the secant there). Stops once
+ * the bracket is no wider than `tolerance`.
+ *
+ * Parameters:
+ *   fLo, fHi - f(lo) and f(hi), of opposite sign or fHi = 0
+ *
+ * Returns:
+ *   An exact zero if one is hit, otherwise the hi end of the final
+ *   bracket, where f has fHi's sign: restarting a search from there cannot
+ *   find the same crossing again
+ */
+template <class F>
+[[nodiscard]] double illinoisRoot(const F& f, double lo, double fLo, double hi, double fHi, double tolerance) {
+    int side = 0;
+    for (int iter = 0; iter < 100 && fHi != 0.0 && hi - lo > tolerance; ++iter) {
+        double root = (lo * fHi - hi * fLo) / (fHi - fLo);
+        if (!(root > lo && root < hi)) {
+            root = 0.5 * (lo + hi);
+            if (!(root > lo && root < hi)) {
+                break;
+            }
+        }
+        const double fRoot = f(root);
+        if (fRoot == 0.0) {
+            return root;
+        }
+        if ((fRoot < 0.0) == (fLo < 0.0)) {
+            lo = root;
+            fLo = fRoot;
+            if (side == -1) {
+                fHi *= 0.5;
+            }
+            side = -1;
+        } else {
+            hi = root;
+            fHi = fRoot;
+            if (side == 1) {
+                fLo *= 0.5;
+            }
+            side = 1;
+        }
+    }
+    return hi;
+}
+
+} // namespace hohmann
+
+#endif // HOHMANN_ROOT_FINDING_HPP
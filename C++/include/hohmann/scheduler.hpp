@@ -0,0 +1,197 @@
+#ifndef HOHMANN_SCHEDULER_HPP
+#define HOHMANN_SCHEDULER_HPP
+
+/*
+ * scheduler.hpp - Library-wide work-stealing task scheduler
+ *
+ * Every parallel engine in hohmann_lib (batch sweeps, gravity-assist search,
+ * Monte Carlo, ...) runs on one TaskScheduler instead of spinning up its own
+ * threads. hohmannd's --threads flag sizes the global instance.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * CancellationToken class - Cooperative stop signal
+ *
+ * Copies share one flag. Cancelling never interrupts a running task; engines
+ * check cancelled() between chunks and skip work that has not started yet.
+ */
+class CancellationToken {
+public:
+    CancellationToken() : m_flag(std::make_shared<std::atomic<bool>>(false)) {}
+
+    void cancel() { m_flag->store(true, std::memory_order_relaxed); }
+    [[nodiscard]] bool cancelled() const { return m_flag->load(std::memory_order_relaxed); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> m_flag;
+};
+
+/*
+ * SchedulerOptions struct - Worker pool configuration
+ */
+struct SchedulerOptions {
+    std::size_t workerCount = 0;  ///< Threads running tasks, caller included; 0 = hardware_concurrency()
+    bool pinThreads = false;      ///< Bind worker i to CPU i (Linux only; ignored elsewhere)
+};
+
+/*
+ * Grain for element-wise batch kernels (one orbit, particle or case per
+ * element): large enough that scheduling costs vanish next to the math
+ */
+constexpr std::size_t batchGrain = 16384;
+
+class TaskScheduler;
+
+/*
+ * TaskGroup class - A set of tasks that can be waited on together
+ *
+ * Tasks may spawn further tasks into the same group. wait() helps execute
+ * queued work instead of blocking, so waiting from inside a task cannot
+ * deadlock the pool. The first exception thrown by any task is rethrown
+ * from wait(); tasks of the group that have not started yet are skipped.
+ */
+class TaskGroup {
+public:
+    explicit TaskGroup(TaskScheduler& scheduler) : m_scheduler(scheduler) {}
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    void spawn(std::function<void()> task);
+    void wait();
+
+private:
+    friend class TaskScheduler;
+
+    void fail(std::exception_ptr error);
+
+    TaskScheduler& m_scheduler;
+    std::atomic<std::size_t> m_pending{0};
+    std::atomic<bool> m_failed{false};
+    std::mutex m_errorMutex;
+    std::exception_ptr m_error;
+};
+
+/*
+ * TaskScheduler class - Fixed pool of workers with per-worker deques
+ *
+ * Each worker owns a Chase-Lev deque: it pushes and pops its own tasks at
+ * the bottom (LIFO, cache-warm, depth-first) while idle workers steal from
+ * the top (FIFO, the oldest and usually largest piece of work). Tasks
+ * submitted from threads outside the pool go through a shared injection
+ * queue. Idle workers sleep on a condition variable.
+ *
+ * A scheduler with workerCount N starts N - 1 background threads: the
+ * thread that waits on a TaskGroup executes tasks too, so N = 1 runs
+ * everything serially on the caller.
+ */
+class TaskScheduler {
+public:
+    explicit TaskScheduler(SchedulerOptions options = {});
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    [[nodiscard]] std::size_t workerCount() const { return m_workerCount; }
+
+    /*
+     * Run body(first, last) over [begin, end) split into chunks
+     *
+     * The range is halved recursively until chunks hold at most `grain`
+     * indices; the halves are spawned so idle workers can steal them.
+     * Ranges no larger than one grain run inline on the calling thread.
+     *
+     * Parameters:
+     *   begin, end - Index range
+     *   grain - Maximum chunk size (0 = pick one giving ~8 chunks per worker)
+     *   body - Called once per chunk with a half-open sub-range
+     *   token - Optional; chunks not yet started are skipped once cancelled
+     */
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+                     const std::function<void(std::size_t, std::size_t)>& body,
+                     const CancellationToken* token = nullptr);
+
+    /*
+     * The process-wide scheduler, created on first use
+     */
+    static TaskScheduler& global();
+
+    /*
+     * Replace the global scheduler's configuration
+     *
+     * Must not be called while work is running on the global scheduler.
+     */
+    static void configureGlobal(SchedulerOptions options);
+
+private:
+    friend class TaskGroup;
+    struct Task;
+    class WorkDeque;
+    struct Worker;
+
+    void submit(Task* task);
+    Task* findTask(std::size_t self);
+    void execute(Task* task);
+    void workerLoop(std::size_t index, bool pin);
+    bool helpOnce();
+
+    std::size_t m_workerCount;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::mutex m_injectMutex;
+    std::deque<Task*> m_injected;
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake;
+    std::atomic<std::size_t> m_queued{0};
+    std::atomic<std::size_t> m_sleepers{0};
+    std::atomic<bool> m_stop{false};
+};
+
+/*
+ * TaskGraph class - Dependency graph of tasks run on a scheduler
+ *
+ * Nodes start once all their predecessors have finished; independent nodes
+ * run in parallel. Cancellation skips nodes that have not started.
+ */
+class TaskGraph {
+public:
+    using NodeId = std::size_t;
+
+    NodeId add(std::function<void()> task);
+
+    /* Require `before` to finish before `after` starts */
+    void precede(NodeId before, NodeId after);
+
+    /*
+     * Execute every node once
+     *
+     * Throws:
+     *   std::logic_error if the graph has a cycle; rethrows the first
+     *   exception thrown by a node
+     */
+    void run(TaskScheduler& scheduler, const CancellationToken* token = nullptr);
+
+    [[nodiscard]] std::size_t size() const { return m_tasks.size(); }
+
+private:
+    std::vector<std::function<void()>> m_tasks;
+    std::vector<std::vector<NodeId>> m_successors;
+};
+
+} // namespace hohmann
+
+#endif // HOHMANN_SCHEDULER_HPP
@@ -0,0 +1,112 @@
+#ifndef HOHMANN_STATION_KEEPING_HPP
+#define HOHMANN_STATION_KEEPING_HPP
+
+/*
+ * station_keeping.hpp - Analytic north-south / east-west station-keeping
+ * delta-v budgets for geostationary slots and fleets
+ */
+
+#include "constants.hpp"
+#include "scheduler.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * StationKeepingBudget struct - Delta-v to hold one GEO slot over a window
+ *
+ * Same shape as TransferResult: component burns plus their total.
+ */
+struct StationKeepingBudget {
+    double northSouthDeltaV;        ///< Inclination control [m/s]
+    double eastWestDeltaV;          ///< Longitude drift control [m/s]
+    double totalDeltaV;             ///< Sum of the two [m/s]
+    double duration;                ///< Window length [s]
+    double inclinationDrift;        ///< Mean luni-solar drift over the window [rad/s]
+    double longitudeAcceleration;   ///< Triaxiality drift at the slot, east positive [rad/s²]
+
+    // Derived values
+    [[nodiscard]] double durationYears() const { return duration / timeScale::julianYear; }
+    /* 0 for an empty window, which costs nothing, as in printSummary() */
+    [[nodiscard]] double totalDeltaVPerYear() const {
+        return duration > 0.0 ? totalDeltaV / durationYears() : 0.0;
+    }
+};
+
+/*
+ * Budget for one slot
+ *
+ *   North-south: di/dt = 0.8457 + 0.0980 cos(Omega_moon) deg/yr, where
+ *                Omega_moon is the longitude of the Moon's ascending node
+ *                (18.6 year cycle), integrated over the window
+ *   East-west:   d²lambda/dt² = -0.00168 sin 2(lambda - 75.07 deg) deg/day²
+ *                from Earth's equatorial ellipticity (J22); the stable
+ *                points are 75.07 E and 255.07 E
+ *
+ * Both are costed as the small, frequent corrections flown in practice:
+ * delta-v = v_GEO * (inclination removed) and (a / 3) * |lambda''| * duration.
+ *
+ * Parameters:
+ *   slotLongitude - East longitude of the slot [rad]
+ *   startEpoch - Window start, seconds past J2000
+ *   duration - Window length [s]
+ *
+ * Throws:
+ *   std::invalid_argument if duration is negative
+ */
+[[nodiscard]] StationKeepingBudget stationKeepingBudget(double slotLongitude, double startEpoch,
+                                                        double duration = timeScale::julianYear);
+
+/*
+ * StationKeepingColumns struct - Structure-of-arrays StationKeepingBudget
+ */
+struct StationKeepingColumns {
+    std::vector<double> northSouthDeltaV;   ///< [m/s]
+    std::vector<double> eastWestDeltaV;     ///< [m/s]
+    std::vector<double> totalDeltaV;        ///< [m/s]
+
+    [[nodiscard]] std::size_t size() const { return totalDeltaV.size(); }
+    void resize(std::size_t count);
+};
+
+/*
+ * Budgets for a fleet sharing one window
+ *
+ * The north-south term depends only on the window, so it is computed once
+ * and broadcast; the per-slot work is one sine.
+ *
+ * Parameters:
+ *   slotLongitudes - East longitudes, `count` entries [rad]
+ *   out - Resized to `count`
+ *
+ * Throws:
+ *   std::invalid_argument if duration is negative
+ */
+void stationKeepingBatch(const double* slotLongitudes, std::size_t count, double startEpoch,
+                         double duration, StationKeepingColumns& out,
+                         const CancellationToken* token = nullptr);
+
+/*
+ * FleetStationKeepingSummary struct - Fleet totals for a budget table
+ */
+struct FleetStationKeepingSummary {
+    std::size_t satellites = 0;
+    double duration = 0.0;              ///< [s]
+    double northSouthDeltaV = 0.0;      ///< Fleet total [m/s]
+    double eastWestDeltaV = 0.0;        ///< Fleet total [m/s]
+    double totalDeltaV = 0.0;           ///< Fleet total [m/s]
+    double maxTotalDeltaV = 0.0;        ///< Most expensive slot [m/s]
+    std::size_t maxIndex = 0;           ///< Index of that slot
+
+    /* Print the totals, per-satellite means and per-year rates to stdout */
+    void printSummary() const;
+};
+
+[[nodiscard]] FleetStationKeepingSummary summarizeStationKeeping(const StationKeepingColumns& budgets,
+                                                                 double duration);
+
+} // namespace hohmann
+
+#endif // HOHMANN_STATION_KEEPING_HPP
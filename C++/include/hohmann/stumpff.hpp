@@ -0,0 +1,47 @@
+#ifndef HOHMANN_STUMPFF_HPP
+#define HOHMANN_STUMPFF_HPP
+
+/*
+ * stumpff.hpp - Stumpff functions C(z) and S(z) for universal-variable
+ * orbit formulations (Lambert's problem, Kepler propagation)
+ *
+ * The same expressions cover ellipses (z > 0), parabolas (z = 0) and
+ * hyperbolas (z < 0). Near z = 0 the closed forms cancel catastrophically,
+ * so a short Taylor series is used there instead.
+ */
+
+#include <cmath>
+
+namespace hohmann {
+
+/*
+ * C(z) = (1 - cos(sqrt(z))) / z, continued through z <= 0
+ */
+[[nodiscard]] inline double stumpffC(double z) {
+    if (z > 1e-6) {
+        return (1.0 - std::cos(std::sqrt(z))) / z;
+    }
+    if (z < -1e-6) {
+        return (std::cosh(std::sqrt(-z)) - 1.0) / (-z);
+    }
+    return 1.0 / 2.0 - z / 24.0 + z * z / 720.0;
+}
+
+/*
+ * S(z) = (sqrt(z) - sin(sqrt(z))) / sqrt(z)^3, continued through z <= 0
+ */
+[[nodiscard]] inline double stumpffS(double z) {
+    if (z > 1e-6) {
+        double sz = std::sqrt(z);
+        return (sz - std::sin(sz)) / (sz * sz * sz);
+    }
+    if (z < -1e-6) {
+        double sz = std::sqrt(-z);
+        return (std::sinh(sz) - sz) / (sz * sz * sz);
+    }
+    return 1.0 / 6.0 - z / 120.0 + z * z / 5040.0;
+}
+
+} // namespace hohmann
+
+#endif // HOHMANN_STUMPFF_HPP
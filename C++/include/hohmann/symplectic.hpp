@@ -0,0 +1,104 @@
+#ifndef HOHMANN_SYMPLECTIC_HPP
+#define HOHMANN_SYMPLECTIC_HPP
+
+/*
+ * symplectic.hpp - Fixed-step symplectic propagation of satellite ensembles
+ * (leapfrog, Yoshida 4th/6th order, Wisdom-Holman)
+ */
+
+#include "orbital_elements.hpp"
+#include "propagator.hpp"
+#include "scheduler.hpp"
+#include "vector3.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * ThirdBody struct - Perturbing body on a circular orbit about the central body
+ *
+ * position(t) = radius * (cos u P + sin u Q), u = phase + meanMotion * t,
+ * with P, Q spanning the plane given by inclination and raan.
+ */
+struct ThirdBody {
+    double gm;            ///< [m³/s²]
+    double radius;        ///< [m]
+    double inclination;   ///< [rad]
+    double raan;          ///< [rad]
+    double meanMotion;    ///< [rad/s]
+    double phase;         ///< Argument of latitude at t = 0 [rad]
+
+    [[nodiscard]] Vec3 position(double t) const;
+
+    /*
+     * Geocentric Sun and Moon in the Earth-equatorial frame, t in seconds
+     * past J2000. Both move in the ecliptic (the Moon's 5 degree tilt is
+     * ignored), which captures the secular luni-solar pull on GEO planes.
+     */
+    static ThirdBody Sun();
+    static ThirdBody Moon();
+};
+
+/*
+ * SymplecticModel struct - Central gravity (point mass + J2) plus third bodies
+ *
+ * The ensemble members are test particles: they feel the model but not
+ * each other.
+ */
+struct SymplecticModel {
+    GravityModel central;
+    std::vector<ThirdBody> thirdBodies;
+};
+
+/*
+ * SymplecticScheme enum - Splitting used for each step
+ *
+ *   Leapfrog      drift(h/2) kick(h) drift(h/2); 2nd order, 1 force call
+ *   Yoshida4      three leapfrog substeps; 4th order, 3 force calls
+ *   Yoshida6      seven leapfrog substeps; 6th order, 7 force calls
+ *   WisdomHolman  Kepler drift(h/2) perturbation kick(h) Kepler drift(h/2);
+ *                 the Kepler part is solved exactly, so the error scales
+ *                 with the perturbation (J2, third bodies) rather than
+ *                 with the central attraction
+ */
+enum class SymplecticScheme { Leapfrog, Yoshida4, Yoshida6, WisdomHolman };
+
+/*
+ * Propagate every state in place by `steps` steps of dt
+ *
+ * Members are processed in cache-sized chunks that each run all steps
+ * before moving on, in parallel on the shared scheduler; the kick and drift
+ * loops run over contiguous columns and vectorize across members.
+ *
+ * Parameters:
+ *   startTime - Model time of the input states (third-body phase) [s]
+ *   token - Optional; chunks not yet started keep their input states
+ *
+ * Returns:
+ *   false if cancelled before every chunk finished
+ *
+ * Throws:
+ *   std::invalid_argument if dt is not positive
+ */
+bool propagateSymplectic(const SymplecticModel& model, SymplecticScheme scheme, StateVectorArray& states,
+                         double startTime, double dt, std::size_t steps,
+                         const CancellationToken* token = nullptr);
+
+/*
+ * Specific orbital energy of each state, including the J2 and third-body
+ * potentials [J/kg]
+ *
+ * Conserved for a model without third bodies; the bounded oscillation of
+ * this value is the usual accuracy check for a symplectic run.
+ *
+ * Parameters:
+ *   energy - Resized to states.size()
+ */
+void specificEnergy(const SymplecticModel& model, const StateVectorArray& states, double time,
+                    std::vector<double>& energy);
+
+} // namespace hohmann
+
+#endif // HOHMANN_SYMPLECTIC_HPP
@@ -0,0 +1,78 @@
+#ifndef HOHMANN_TOP_K_HPP
+#define HOHMANN_TOP_K_HPP
+
+/*
+ * top_k.hpp - Streaming "k smallest" reducer for grid searches
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * RankedIndex struct - One kept case: its score and where it came from
+ */
+struct RankedIndex {
+    double value;
+    std::size_t index;
+};
+
+/*
+ * TopKReducer class - Keeps the k smallest (value, index) pairs seen
+ *
+ * A bounded max-heap: the root is the worst case still kept, so most offers
+ * are rejected with one comparison. Ties on value are broken by the lower
+ * index, which makes the result independent of the order cases arrive in -
+ * per-thread reducers merged in any order give the same answer.
+ *
+ * Memory is O(k) regardless of how many cases are offered.
+ */
+class TopKReducer {
+public:
+    explicit TopKReducer(std::size_t k) : m_k(k) { m_heap.reserve(k); }
+
+    /*
+     * Consider one case; NaN values are ignored
+     */
+    void offer(double value, std::size_t index) {
+        if (std::isnan(value) || m_k == 0) {
+            return;
+        }
+        RankedIndex candidate{value, index};
+        if (m_heap.size() < m_k) {
+            m_heap.push_back(candidate);
+            std::push_heap(m_heap.begin(), m_heap.end(), ranksBefore);
+        } else if (ranksBefore(candidate, m_heap.front())) {
+            std::pop_heap(m_heap.begin(), m_heap.end(), ranksBefore);
+            m_heap.back() = candidate;
+            std::push_heap(m_heap.begin(), m_heap.end(), ranksBefore);
+        }
+    }
+
+    /* Fold in another reducer's kept cases */
+    void merge(const TopKReducer& other);
+
+    /* Kept cases, best first */
+    [[nodiscard]] std::vector<RankedIndex> sorted() const;
+
+    /* Worst value still kept; offers must beat it once the reducer is full */
+    [[nodiscard]] double threshold() const;
+
+    [[nodiscard]] std::size_t capacity() const { return m_k; }
+    [[nodiscard]] std::size_t size() const { return m_heap.size(); }
+
+private:
+    static bool ranksBefore(const RankedIndex& a, const RankedIndex& b) {
+        return a.value < b.value || (a.value == b.value && a.index < b.index);
+    }
+
+    std::size_t m_k;
+    std::vector<RankedIndex> m_heap;  // Max-heap under ranksBefore
+};
+
+} // namespace hohmann
+
+#endif // HOHMANN_TOP_K_HPP
@@ -0,0 +1,80 @@
+#ifndef HOHMANN_TOUR_HPP
+#define HOHMANN_TOUR_HPP
+
+/*
+ * tour.hpp - Multi-target tours: in which order should one servicer visit
+ * many target orbits (e.g. active debris removal) to spend the least delta-v?
+ */
+
+#include "assignment.hpp"
+#include "scheduler.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * TourOptions struct - Search effort and reproducibility controls
+ *
+ * Each start builds its own randomized tour and improves it independently;
+ * the starts run in parallel on the shared scheduler. Start s always uses
+ * the same random stream for a given seed, so the result does not depend on
+ * the number of threads.
+ */
+struct TourOptions {
+    std::size_t starts = 8;          ///< Independent searches
+    std::size_t iterations = 1000;   ///< Destroy/repair rounds per start
+    std::size_t removeCount = 10;    ///< Targets removed per round
+    std::size_t neighbors = 16;      ///< Candidate list length for 2-opt / Or-opt
+    std::uint64_t seed = 0;
+};
+
+/*
+ * ServicerTour struct - Best visiting order found
+ */
+struct ServicerTour {
+    std::vector<std::size_t> order;   ///< Target indices in visiting order
+    std::vector<double> legDeltaV;    ///< legDeltaV[k] = cost of reaching order[k] [m/s]
+    double totalDeltaV = 0.0;         ///< [m/s]
+};
+
+/*
+ * Delta-v of visiting targets in a given order, starting from the servicer
+ *
+ * Each leg costs reconfigurationDeltaV() (Hohmann plus plane change).
+ *
+ * Throws:
+ *   std::invalid_argument if order is not a permutation of the targets
+ */
+[[nodiscard]] double tourDeltaV(const SlotOrbit& servicer, const std::vector<SlotOrbit>& targets,
+                                const std::vector<std::size_t>& order, double mu);
+
+/*
+ * Cheapest order to visit every target once, starting from the servicer
+ *
+ * The tour is open: the servicer stays at the last target. Each start runs
+ * large-neighbourhood search - remove a cluster of related targets, reinsert
+ * them at their cheapest positions - followed by 2-opt and Or-opt local
+ * search over nearest-neighbour candidate lists. Every move is scored by
+ * the handful of legs it changes, never by re-summing the tour.
+ *
+ * Parameters:
+ *   servicer - Starting orbit
+ *   targets - Orbits to visit
+ *   mu - Gravitational parameter [m³/s²]
+ *   options - Search effort
+ *   token - Optional; starts stop improving once cancelled
+ *
+ * Throws:
+ *   std::invalid_argument if options.starts is 0 or any radius is not positive
+ */
+[[nodiscard]] ServicerTour optimizeTour(const SlotOrbit& servicer,
+                                        const std::vector<SlotOrbit>& targets, double mu,
+                                        TourOptions options = {},
+                                        const CancellationToken* token = nullptr);
+
+} // namespace hohmann
+
+#endif // HOHMANN_TOUR_HPP
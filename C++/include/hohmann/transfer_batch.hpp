@@ -0,0 +1,168 @@
+#ifndef HOHMANN_TRANSFER_BATCH_HPP
+#define HOHMANN_TRANSFER_BATCH_HPP
+
+/*
+ * transfer_batch.hpp - Batch and grid-sweep evaluation of two-impulse transfers
+ */
+
+#include "top_k.hpp"
+#include "transfer_kernel.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace hohmann {
+
+/*
+ * TransferColumns struct - Structure-of-arrays version of TransferResult
+ *
+ * One entry per evaluated case. `option` records which tangent variant was
+ * chosen (always PeriapsisToApoapsis for circular endpoints).
+ */
+struct TransferColumns {
+    std::vector<double> deltaV1;        ///< [m/s]
+    std::vector<double> deltaV2;        ///< [m/s]
+    std::vector<double> totalDeltaV;    ///< [m/s]
+    std::vector<double> transferTime;   ///< [s]
+    std::vector<double> semiMajorAxis;  ///< [m]
+    std::vector<TangentOption> option;
+
+    [[nodiscard]] std::size_t size() const { return totalDeltaV.size(); }
+    void resize(std::size_t count);
+
+    [[nodiscard]] TransferResult at(std::size_t index) const;
+};
+
+/*
+ * Evaluate many circular-to-circular transfers around one body
+ *
+ * Parameters:
+ *   r1, r2 - Initial and final orbit radii, `count` entries each [m]
+ *   count - Number of cases
+ *   mu - Gravitational parameter [m³/s²]
+ *   out - Output columns (resized to `count`; no allocation if already sized)
+ *
+ * Throws:
+ *   std::invalid_argument if any radius is not positive
+ */
+void calculateTransferBatch(const double* r1, const double* r2, std::size_t count,
+                            double mu, TransferColumns& out);
+
+/*
+ * TransferGradientColumns struct - Structure-of-arrays TransferGradient
+ */
+struct TransferGradientColumns {
+    std::vector<double> totalDeltaV;    ///< [m/s]
+    std::vector<double> transferTime;   ///< [s]
+    std::vector<double> deltaVByR1;     ///< d totalDeltaV / d r1
+    std::vector<double> deltaVByR2;     ///< d totalDeltaV / d r2
+    std::vector<double> deltaVByMu;     ///< d totalDeltaV / d mu
+    std::vector<double> timeByR1;       ///< d transferTime / d r1
+    std::vector<double> timeByR2;       ///< d transferTime / d r2
+    std::vector<double> timeByMu;       ///< d transferTime / d mu
+
+    [[nodiscard]] std::size_t size() const { return totalDeltaV.size(); }
+    void resize(std::size_t count);
+};
+
+/*
+ * Evaluate many circular transfers together with their gradients
+ *
+ * The kernel runs on Dual<3, Lanes<4>>: four cases per evaluation, each
+ * carrying derivatives with respect to (r1, r2, mu), so every arithmetic
+ * step is a short loop over lanes that the compiler vectorizes.
+ *
+ * Throws:
+ *   std::invalid_argument if any radius is not positive
+ */
+void calculateTransferGradientBatch(const double* r1, const double* r2, std::size_t count,
+                                    double mu, TransferGradientColumns& out);
+
+/*
+ * Evaluate many coaxial elliptic-to-elliptic transfers around one body
+ *
+ * Same as above with two extra input columns: the radii are periapsis radii
+ * and e1/e2 are the eccentricities of the initial and final orbits. Each
+ * case picks the cheaper TangentOption.
+ *
+ * Throws:
+ *   std::invalid_argument if any radius is not positive or any
+ *   eccentricity is outside [0, 1)
+ */
+void calculateTransferBatch(const double* r1, const double* r2,
+                            const double* e1, const double* e2, std::size_t count,
+                            double mu, TransferColumns& out);
+
+/*
+ * Evaluate every (initial, final) pair on a rectangular grid
+ *
+ * Results are row-major: index = i * finalRadii.size() + j.
+ *
+ * Parameters:
+ *   initialRadii - Initial (periapsis) radii, one per row [m]
+ *   finalRadii - Final (periapsis) radii, one per column [m]
+ *   mu - Gravitational parameter [m³/s²]
+ *   initialEccentricities - Empty for circular, else one per row
+ *   finalEccentricities - Empty for circular, else one per column
+ *
+ * Returns:
+ *   TransferColumns with initialRadii.size() * finalRadii.size() entries
+ *
+ * Throws:
+ *   std::invalid_argument on mismatched eccentricity column lengths
+ */
+[[nodiscard]] TransferColumns sweepTransfers(const std::vector<double>& initialRadii,
+                                             const std::vector<double>& finalRadii,
+                                             double mu,
+                                             const std::vector<double>& initialEccentricities = {},
+                                             const std::vector<double>& finalEccentricities = {});
+
+/*
+ * TransferMetric enum - Which result column to rank by
+ */
+enum class TransferMetric : unsigned char {
+    TotalDeltaV,
+    DeltaV1,
+    DeltaV2,
+    TransferTime
+};
+
+/*
+ * RankedTransfer struct - One of the k best grid cases
+ */
+struct RankedTransfer {
+    std::size_t index;      ///< Row-major grid index, as in sweepTransfers()
+    TransferResult result;
+    TangentOption option;
+};
+
+/*
+ * The k best cases of a sweepTransfers() grid, without storing the grid
+ *
+ * Rows are evaluated in parallel chunks; each chunk keeps a TopKReducer and
+ * merges it into the global one when done, so memory is O(k x threads)
+ * instead of O(rows x columns). Ties go to the lower grid index.
+ *
+ * Parameters:
+ *   Same as sweepTransfers(), plus
+ *   k - Number of cases to keep
+ *   metric - Column to minimize
+ *
+ * Returns:
+ *   Up to k cases, best first
+ *
+ * Throws:
+ *   std::invalid_argument on invalid radii/eccentricities or mismatched
+ *   eccentricity column lengths
+ */
+[[nodiscard]] std::vector<RankedTransfer> sweepTransfersTopK(
+    const std::vector<double>& initialRadii,
+    const std::vector<double>& finalRadii,
+    double mu, std::size_t k,
+    TransferMetric metric = TransferMetric::TotalDeltaV,
+    const std::vector<double>& initialEccentricities = {},
+    const std::vector<double>& finalEccentricities = {});
+
+} // namespace hohmann
+
+#endif // HOHMANN_TRANSFER_BATCH_HPP
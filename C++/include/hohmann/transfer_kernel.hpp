@@ -0,0 +1,135 @@
+#ifndef HOHMANN_TRANSFER_KERNEL_HPP
+#define HOHMANN_TRANSFER_KERNEL_HPP
+
+/*
+ * transfer_kernel.hpp - The one implementation of the two-impulse transfer
+ * math, used by HohmannTransfer (values and gradient) and the batch/sweep
+ * engines
+ *
+ * The kernels take raw numbers and write a BasicTransferResult so the same
+ * code runs for a single Orbit pair and inside tight loops over millions of
+ * cases. Keeping them in a header lets the compiler inline them into those
+ * loops. They are templates over the number type: double for values,
+ * Dual<N> (dual.hpp) for values plus exact gradients.
+ */
+
+#include "hohmann_transfer.hpp"
+#include "constants.hpp"
+#include "dual.hpp"
+
+#include <cmath>
+
+namespace hohmann {
+
+/*
+ * TangentOption enum - Which apsides a coaxial-ellipse transfer connects
+ *
+ * The two ellipses share an apse line with their periapses on the same side,
+ * so a half-ellipse transfer can only join points 180 degrees apart:
+ *   PeriapsisToApoapsis - burn at initial periapsis, arrive at final apoapsis
+ *   ApoapsisToPeriapsis - burn at initial apoapsis, arrive at final periapsis
+ */
+enum class TangentOption : unsigned char {
+    PeriapsisToApoapsis,
+    ApoapsisToPeriapsis
+};
+
+/*
+ * Tangential half-ellipse transfer between two apsis points
+ *
+ * Parameters:
+ *   departureRadius - Radius of the departure burn [m]
+ *   departureSma - Semi-major axis of the orbit being left [m]
+ *   arrivalRadius - Radius of the arrival burn (opposite side) [m]
+ *   arrivalSma - Semi-major axis of the orbit being entered [m]
+ *   mu - Gravitational parameter [m³/s²]
+ *
+ * Returns:
+ *   Burn magnitudes, transfer time and transfer semi-major axis
+ */
+template <class T>
+[[nodiscard]] inline BasicTransferResult<T> tangentTransfer(const T& departureRadius, const T& departureSma,
+                                                            const T& arrivalRadius, const T& arrivalSma,
+                                                            const T& mu) {
+    // Unqualified calls pick std:: for double and the dual.hpp overloads for Dual
+    using std::abs;
+    using std::pow;
+    using std::sqrt;
+
+    T a_transfer = (departureRadius + arrivalRadius) / 2.0;
+
+    // Vis-viva at both ends of both orbits; all four velocities are purely
+    // tangential because every point involved is an apsis
+    T v_departure = sqrt(mu * (2.0 / departureRadius - 1.0 / departureSma));
+    T v_transfer_departure = sqrt(mu * (2.0 / departureRadius - 1.0 / a_transfer));
+    T v_transfer_arrival = sqrt(mu * (2.0 / arrivalRadius - 1.0 / a_transfer));
+    T v_arrival = sqrt(mu * (2.0 / arrivalRadius - 1.0 / arrivalSma));
+
+    BasicTransferResult<T> result;
+    result.deltaV1 = abs(v_transfer_departure - v_departure);
+    result.deltaV2 = abs(v_arrival - v_transfer_arrival);
+    result.totalDeltaV = result.deltaV1 + result.deltaV2;
+    result.transferTime = math::pi * sqrt(pow(a_transfer, 3) / mu);
+    result.semiMajorAxis = a_transfer;
+    return result;
+}
+
+/*
+ * Cheapest tangential transfer between two coaxial, coplanar ellipses
+ *
+ * Evaluates both TangentOption variants and keeps the one with the lower
+ * total delta-v. With both eccentricities zero the two variants coincide
+ * and the result is the classic circular Hohmann transfer.
+ *
+ * Parameters:
+ *   rp1, e1 - Periapsis radius [m] and eccentricity of the initial orbit
+ *   rp2, e2 - Periapsis radius [m] and eccentricity of the final orbit
+ *   mu - Gravitational parameter [m³/s²]
+ *   result - Output transfer parameters
+ *
+ * Returns:
+ *   The TangentOption that was selected
+ */
+template <class T>
+inline TangentOption coaxialTransfer(const T& rp1, const T& e1, const T& rp2, const T& e2,
+                                     const T& mu, BasicTransferResult<T>& result) {
+    T a1 = rp1 / (1.0 - e1);
+    T a2 = rp2 / (1.0 - e2);
+    T ra1 = a1 * (1.0 + e1);
+    T ra2 = a2 * (1.0 + e2);
+
+    BasicTransferResult<T> peri_to_apo = tangentTransfer(rp1, a1, ra2, a2, mu);
+    BasicTransferResult<T> apo_to_peri = tangentTransfer(ra1, a1, rp2, a2, mu);
+
+    // Ties (including every circular case) resolve to the periapsis variant
+    if (apo_to_peri.totalDeltaV < peri_to_apo.totalDeltaV) {
+        result = apo_to_peri;
+        return TangentOption::ApoapsisToPeriapsis;
+    }
+    result = peri_to_apo;
+    return TangentOption::PeriapsisToApoapsis;
+}
+
+/*
+ * Circular transfer with its gradient with respect to (r1, r2, mu)
+ *
+ * One evaluation on Dual<3> replaces the six extra evaluations that
+ * central finite differences would need, and the derivatives are exact.
+ */
+[[nodiscard]] inline TransferGradient transferGradient(double r1, double r2, double mu) {
+    using D = Dual<3>;
+    const D radius1 = D::variable(r1, 0);
+    const D radius2 = D::variable(r2, 1);
+    const BasicTransferResult<D> d = tangentTransfer(radius1, radius1, radius2, radius2, D::variable(mu, 2));
+
+    TransferGradient g;
+    g.result = {d.deltaV1.value, d.deltaV2.value, d.totalDeltaV.value, d.transferTime.value,
+                d.semiMajorAxis.value};
+    g.totalDeltaV = d.totalDeltaV.grad;
+    g.transferTime = d.transferTime.grad;
+    return g;
+}
+
+} // namespace hohmann
+
+#endif // HOHMANN_TRANSFER_KERNEL_HPP
@@ -0,0 +1,49 @@
+#ifndef HOHMANN_VECTOR3_HPP
+#define HOHMANN_VECTOR3_HPP
+
+/*
+ * vector3.hpp - Minimal 3D vector type for position/velocity arithmetic
+ *
+ * Header-only on purpose: every operation is a handful of multiplies, so
+ * keeping them inline lets the compiler fold them into the calling loop.
+ */
+
+#include <cmath>
+
+namespace hohmann {
+
+/*
+ * Vec3 struct - Cartesian 3-vector (plain aggregate, no invariants)
+ */
+struct Vec3 {
+    double x = 0.0;
+    double y = 0.0;
+    double z = 0.0;
+
+    Vec3& operator+=(const Vec3& o) { x += o.x; y += o.y; z += o.z; return *this; }
+    Vec3& operator-=(const Vec3& o) { x -= o.x; y -= o.y; z -= o.z; return *this; }
+    Vec3& operator*=(double s) { x *= s; y *= s; z *= s; return *this; }
+};
+
+inline Vec3 operator+(Vec3 a, const Vec3& b) { return a += b; }
+inline Vec3 operator-(Vec3 a, const Vec3& b) { return a -= b; }
+inline Vec3 operator-(const Vec3& a) { return {-a.x, -a.y, -a.z}; }
+inline Vec3 operator*(Vec3 a, double s) { return a *= s; }
+inline Vec3 operator*(double s, Vec3 a) { return a *= s; }
+inline Vec3 operator/(const Vec3& a, double s) { return a * (1.0 / s); }
+
+[[nodiscard]] inline double dot(const Vec3& a, const Vec3& b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+[[nodiscard]] inline Vec3 cross(const Vec3& a, const Vec3& b) {
+    return {a.y * b.z - a.z * b.y,
+            a.z * b.x - a.x * b.z,
+            a.x * b.y - a.y * b.x};
+}
+
+[[nodiscard]] inline double norm(const Vec3& a) { return std::sqrt(dot(a, a)); }
+
+} // namespace hohmann
+
+#endif // HOHMANN_VECTOR3_HPP
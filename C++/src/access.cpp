@@ -0,0 +1,382 @@
+/*
+ * access.cpp - Ground tracks and ground-station access windows
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Seeing a Satellite From the Ground
+ * ==============================================================================
+ *
+ * Orbits are computed in an inertial frame, but ground stations turn with
+ * the Earth. Converting between the two is a rotation about the pole by
+ * the Greenwich sidereal angle theta, which advances 360.9856 deg per day:
+ *
+ *   x_fixed =  cos(theta) x + sin(theta) y
+ *   y_fixed = -sin(theta) x + cos(theta) y
+ *   z_fixed =  z
+ *
+ * GROUND TRACK:
+ * -------------
+ * The point directly below the satellite. Because the Earth turns under
+ * the orbit, each revolution crosses the equator further west - by about
+ * 22.5 deg for a 90-minute LEO:
+ *
+ *     lat
+ *   +50 |   .--.            .--.            .--.
+ *     0 |--/----\----------/----\----------/----\----
+ *   -50 |-'      '--------'      '--------'      '--
+ *       +------------------------------------------> lon
+ *
+ * ELEVATION AND ACCESS:
+ * ---------------------
+ * A station at R_s with local vertical u sees the satellite at r when the
+ * line of sight rho = r - R_s is above its elevation mask:
+ *
+ *                       * satellite
+ *                      /
+ *                rho  /
+ *           u ^      /  elevation
+ *             |     /
+ *             |    /__________  local horizon
+ *          station
+ *
+ *   sin(elevation) = (rho . u) / |rho|
+ *
+ * An access window runs from rise (elevation climbs through the mask) to
+ * set (it falls back below). A LEO pass lasts up to ~10-15 minutes; GEO
+ * satellites are either always or never in view.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. SHARED LOOKUP TABLE
+ *    - cos and sin of the sidereal angle are tabulated once per sample and
+ *      reused by every satellite
+ *
+ * 2. COLUMN-WISE DOT PRODUCTS
+ *    - Earth-fixed positions of one satellite are stored as x/y/z columns
+ *      over time; the visibility of a station is then a branch-free loop
+ *      over contiguous doubles that the compiler vectorizes
+ *
+ * 3. COARSE SCREEN, EXACT REFINEMENT
+ *    - Samples only locate sign changes; rise and set come from regula
+ *      falsi on the exact motion, so accuracy does not depend on timeStep
+ *
+ * See also:
+ *   root_finding.hpp for the root finder shared with the event propagators
+ */
+
+#include "hohmann/access.hpp"
+#include "hohmann/constants.hpp"
+#include "hohmann/root_finding.hpp"
+#include "hohmann/scheduler.hpp"
+#include "hohmann/vector3.hpp"
+
+#include <algorithm>    // std::sort, std::min, std::max
+#include <cmath>        // std::sqrt, std::sin, std::cos, std::atan2, std::asin, std::fmod, std::remainder
+#include <mutex>        // std::mutex, std::lock_guard
+#include <stdexcept>    // std::invalid_argument
+
+namespace hohmann {
+
+namespace {
+
+/**
+ * Elliptic orbit with optional J2 secular drift of node, perigee and mean
+ * anomaly, evaluated at time tau after the element epoch
+ */
+struct SecularOrbit {
+    double a, e, b, inclination;
+    double raan0, argp0, m0;
+    double raanRate, argpRate, meanMotion;
+
+    SecularOrbit(const KeplerianElements& el, bool j2Secular) {
+        a = el.semiMajorAxis;
+        e = el.eccentricity;
+        b = a * std::sqrt(1.0 - e * e);
+        inclination = el.inclination;
+        raan0 = el.raan;
+        argp0 = el.argumentOfPeriapsis;
+        const double nu = el.trueAnomaly;
+        const double ecc = std::atan2(std::sqrt(1.0 - e * e) * std::sin(nu), e + std::cos(nu));
+        m0 = ecc - e * std::sin(ecc);
+
+        const double n = std::sqrt(gm::earth / (a * a * a));
+        raanRate = argpRate = 0.0;
+        meanMotion = n;
+        if (j2Secular) {
+            const double p = a * (1.0 - e * e);
+            const double k = zonal::earthJ2 * (zonal::earthEquatorialRadius / p) *
+                             (zonal::earthEquatorialRadius / p);
+            const double ci = std::cos(inclination);
+            raanRate = -1.5 * n * k * ci;
+            argpRate = 0.75 * n * k * (5.0 * ci * ci - 1.0);
+            meanMotion = n * (1.0 + 0.75 * k * std::sqrt(1.0 - e * e) * (3.0 * ci * ci - 1.0));
+        }
+    }
+
+    [[nodiscard]] Vec3 position(double tau) const {
+        const double m = std::remainder(m0 + meanMotion * tau, math::twoPi);
+        double ecc = m + e * std::sin(m);
+        for (int iter = 0; iter < 30; ++iter) {
+            const double delta = (ecc - e * std::sin(ecc) - m) / (1.0 - e * std::cos(ecc));
+            ecc -= delta;
+            if (std::abs(delta) < 1e-13) {
+                break;
+            }
+        }
+        const double xp = a * (std::cos(ecc) - e), yp = b * std::sin(ecc);
+
+        const double raan = raan0 + raanRate * tau, argp = argp0 + argpRate * tau;
+        const double cO = std::cos(raan), sO = std::sin(raan);
+        const double cw = std::cos(argp), sw = std::sin(argp);
+        const double ci = std::cos(inclination), si = std::sin(inclination);
+        const Vec3 p{cO * cw - sO * sw * ci, sO * cw + cO * sw * ci, sw * si};
+        const Vec3 q{-cO * sw - sO * cw * ci, -sO * sw + cO * cw * ci, cw * si};
+        return xp * p + yp * q;
+    }
+};
+
+/* Inertial to Earth-fixed for a sidereal angle given by its cosine and sine */
+Vec3 toEarthFixed(const Vec3& r, double c, double s) {
+    return {c * r.x + s * r.y, -s * r.x + c * r.y, r.z};
+}
+
+/**
+ * Station geometry in the Earth-fixed frame
+ */
+struct StationFrame {
+    Vec3 position, up;
+    double sinMask;
+
+    explicit StationFrame(const GroundStation& station) {
+        const double cl = std::cos(station.latitude);
+        up = {cl * std::cos(station.longitude), cl * std::sin(station.longitude), std::sin(station.latitude)};
+        position = (bodyRadius::earth + station.altitude) * up;
+        sinMask = std::sin(station.minElevation);
+    }
+
+    /* Positive above the mask, with the sign of sin(el) - sin(mask) */
+    [[nodiscard]] double visibility(const Vec3& fixed) const {
+        const Vec3 rho = fixed - position;
+        return dot(rho, up) - sinMask * norm(rho);
+    }
+
+    [[nodiscard]] double elevation(const Vec3& fixed) const {
+        const Vec3 rho = fixed - position;
+        return std::asin(dot(rho, up) / norm(rho));
+    }
+};
+
+/* Sample times relative to the start: 0, step, ..., duration */
+std::vector<double> sampleTimes(double duration, double step) {
+    const auto intervals = static_cast<std::size_t>(std::ceil(duration / step));
+    std::vector<double> times(intervals + 1);
+    for (std::size_t k = 0; k < times.size(); ++k) {
+        times[k] = std::min(static_cast<double>(k) * step, duration);
+    }
+    return times;
+}
+
+void validate(double duration, const AccessOptions& options) {
+    if (!(duration >= 0.0)) {
+        throw std::invalid_argument("Access duration must not be negative");
+    }
+    if (!(options.timeStep > 0.0) || !(options.timeTolerance > 0.0)) {
+        throw std::invalid_argument("Access time step and tolerance must be positive");
+    }
+}
+
+void validateElements(const KeplerianElements& el) {
+    if (!(el.semiMajorAxis > 0.0) || !(el.eccentricity >= 0.0 && el.eccentricity < 1.0)) {
+        throw std::invalid_argument("Access computation needs elliptic orbits");
+    }
+}
+
+/* Maximum of a unimodal f on [lo, hi] by golden-section search */
+template <class F>
+double goldenMaximum(const F& f, double lo, double hi, double tolerance) {
+    const double ratio = 0.5 * (std::sqrt(5.0) - 1.0);
+    double x1 = hi - ratio * (hi - lo), x2 = lo + ratio * (hi - lo);
+    double f1 = f(x1), f2 = f(x2);
+    while (hi - lo > tolerance) {
+        if (f1 < f2) {
+            lo = x1;
+            x1 = x2;
+            f1 = f2;
+            x2 = lo + ratio * (hi - lo);
+            f2 = f(x2);
+        } else {
+            hi = x2;
+            x2 = x1;
+            f2 = f1;
+            x1 = hi - ratio * (hi - lo);
+            f1 = f(x1);
+        }
+    }
+    return 0.5 * (lo + hi);
+}
+
+} // namespace
+
+double siderealAngle(double epoch) {
+    const double theta = earthOrientation::siderealAngleJ2000 * math::degToRad + earthOrientation::rotationRate * epoch;
+    const double wrapped = std::fmod(theta, math::twoPi);
+    return wrapped < 0.0 ? wrapped + math::twoPi : wrapped;
+}
+
+void GroundTrackColumns::resize(std::size_t count) {
+    time.resize(count);
+    latitude.resize(count);
+    longitude.resize(count);
+    altitude.resize(count);
+}
+
+GroundTrackColumns groundTrack(const KeplerianElements& elements, double startEpoch, double duration,
+                               const AccessOptions& options) {
+    validate(duration, options);
+    validateElements(elements);
+    const SecularOrbit orbit(elements, options.j2Secular);
+    const std::vector<double> times = sampleTimes(duration, options.timeStep);
+    const double theta0 = siderealAngle(startEpoch);
+
+    GroundTrackColumns track;
+    track.resize(times.size());
+    for (std::size_t k = 0; k < times.size(); ++k) {
+        const double theta = theta0 + earthOrientation::rotationRate * times[k];
+        const Vec3 fixed = toEarthFixed(orbit.position(times[k]), std::cos(theta), std::sin(theta));
+        const double r = norm(fixed);
+        track.time[k] = startEpoch + times[k];
+        track.latitude[k] = std::asin(fixed.z / r);
+        track.longitude[k] = std::atan2(fixed.y, fixed.x);
+        track.altitude[k] = r - bodyRadius::earth;
+    }
+    return track;
+}
+
+AccessResult findAccessWindows(const KeplerianElementsArray& satellites,
+                               const std::vector<GroundStation>& stations, double startEpoch,
+                               double duration, const AccessOptions& options, const CancellationToken* token) {
+    validate(duration, options);
+    const std::size_t count = satellites.size();
+    std::vector<SecularOrbit> orbits;
+    orbits.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const KeplerianElements el = satellites.at(i);
+        validateElements(el);
+        orbits.emplace_back(el, options.j2Secular);
+    }
+    std::vector<StationFrame> frames(stations.begin(), stations.end());
+
+    // Sidereal table shared by every satellite
+    const std::vector<double> times = sampleTimes(duration, options.timeStep);
+    const std::size_t samples = times.size();
+    const double theta0 = siderealAngle(startEpoch);
+    std::vector<double> cosTheta(samples), sinTheta(samples);
+    for (std::size_t k = 0; k < samples; ++k) {
+        const double theta = theta0 + earthOrientation::rotationRate * times[k];
+        cosTheta[k] = std::cos(theta);
+        sinTheta[k] = std::sin(theta);
+    }
+
+    // Elevation is flat at culmination: a timing error dt changes it by only
+    // ~(v / range)² dt² / 2, so the peak needs far less precision than rise / set
+    const double culminationTolerance = std::max(options.timeTolerance, 0.01 * options.timeStep);
+
+    AccessResult result;
+    std::vector<AccessWindow>& windows = result.windows;
+    std::size_t satellitesDone = 0;
+    std::mutex mergeMutex;
+
+    TaskScheduler::global().parallelFor(0, count, 0, [&](std::size_t first, std::size_t last) {
+        std::vector<double> fx(samples), fy(samples), fz(samples), f(samples);
+        std::vector<AccessWindow> local;
+        std::size_t done = 0;
+
+        for (std::size_t i = first; i < last; ++i) {
+            if (token && token->cancelled()) {
+                break;
+            }
+            ++done;
+            const SecularOrbit& orbit = orbits[i];
+            for (std::size_t k = 0; k < samples; ++k) {
+                const Vec3 r = orbit.position(times[k]);
+                fx[k] = cosTheta[k] * r.x + sinTheta[k] * r.y;
+                fy[k] = -sinTheta[k] * r.x + cosTheta[k] * r.y;
+                fz[k] = r.z;
+            }
+            auto fixedAt = [&](double tau) {
+                const double theta = theta0 + earthOrientation::rotationRate * tau;
+                return toEarthFixed(orbit.position(tau), std::cos(theta), std::sin(theta));
+            };
+
+            for (std::size_t s = 0; s < frames.size(); ++s) {
+                const StationFrame& st = frames[s];
+                const double px = st.position.x, py = st.position.y, pz = st.position.z;
+                const double ux = st.up.x, uy = st.up.y, uz = st.up.z;
+                const double sinMask = st.sinMask;
+                for (std::size_t k = 0; k < samples; ++k) {
+                    const double rx = fx[k] - px, ry = fy[k] - py, rz = fz[k] - pz;
+                    f[k] = rx * ux + ry * uy + rz * uz - sinMask * std::sqrt(rx * rx + ry * ry + rz * rz);
+                }
+
+                auto visibility = [&](double tau) { return st.visibility(fixedAt(tau)); };
+                auto elevation = [&](double tau) { return st.elevation(fixedAt(tau)); };
+                auto close = [&](double rise, double set, std::size_t firstSample, std::size_t lastSample) {
+                    // Bracket the highest sample, then polish the culmination
+                    std::size_t best = firstSample;
+                    for (std::size_t k = firstSample; k <= lastSample; ++k) {
+                        if (f[k] > f[best]) {
+                            best = k;
+                        }
+                    }
+                    const double lo = std::max(rise, times[best > 0 ? best - 1 : 0]);
+                    const double hi = std::min(set, times[std::min(best + 1, samples - 1)]);
+                    const double peak = hi > lo ? goldenMaximum(elevation, lo, hi, culminationTolerance)
+                                                : times[best];
+                    local.push_back({static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(s),
+                                     startEpoch + rise, startEpoch + set, elevation(peak), startEpoch + peak});
+                };
+
+                bool open = f[0] >= 0.0;
+                double rise = 0.0;
+                std::size_t riseSample = 0;
+                for (std::size_t k = 1; k < samples; ++k) {
+                    const bool visible = f[k] >= 0.0;
+                    if (visible == open) {
+                        continue;
+                    }
+                    const double crossing = illinoisRoot(visibility, times[k - 1], f[k - 1], times[k], f[k],
+                                                         options.timeTolerance);
+                    if (visible) {
+                        rise = crossing;
+                        riseSample = k;
+                    } else {
+                        close(rise, crossing, riseSample, k - 1);
+                    }
+                    open = visible;
+                }
+                if (open) {
+                    close(rise, times.back(), riseSample, samples - 1);
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        windows.insert(windows.end(), local.begin(), local.end());
+        satellitesDone += done;
+    }, token);
+    result.complete = satellitesDone == count;
+
+    std::sort(windows.begin(), windows.end(), [](const AccessWindow& a, const AccessWindow& b) {
+        if (a.satellite != b.satellite) {
+            return a.satellite < b.satellite;
+        }
+        if (a.station != b.station) {
+            return a.station < b.station;
+        }
+        return a.rise < b.rise;
+    });
+    return result;
+}
+
+} // namespace hohmann
@@ -268,6 +268,29 @@ CelestialBody CelestialBody::Sun() {
     return CelestialBody("Sun", gm::sun, bodyRadius::sun);
 }
 
+/**
+ * Create the Venus celestial body.
+ *
+ * AEROSPACE: Venus
+ * ----------------
+ * Earth's inner neighbor and the most-used gravity-assist body for reaching
+ * both the inner and outer solar system (Galileo's VEEGA, Cassini's VVEJGA,
+ * Parker Solar Probe's seven Venus flybys).
+ *
+ * Key data:
+ *   GM:     3.249 x 10^14 m^3/s^2 (~0.82 of Earth)
+ *   Radius: 6.052 x 10^6 m (6,052 km)
+ *
+ * Venus is almost Earth's twin in size, so a close flyby bends a
+ * spacecraft's path nearly as strongly as an Earth flyby does.
+ *
+ * Returns:
+ *   CelestialBody representing Venus
+ */
+CelestialBody CelestialBody::Venus() {
+    return CelestialBody("Venus", gm::venus, bodyRadius::venus);
+}
+
 /**
  * Create the Earth celestial body.
  *
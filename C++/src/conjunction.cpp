@@ -0,0 +1,497 @@
+/*
+ * conjunction.cpp - Satellite conjunction screening
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Conjunction Screening
+ * ==============================================================================
+ *
+ * Operators must know, days ahead, which pairs of objects will pass within
+ * a few kilometres of each other (a "conjunction") so that a collision
+ * avoidance manoeuvre can be planned. With 50,000 catalogued objects there
+ * are 1.25 billion pairs - far too many to propagate pairwise. Screening
+ * therefore discards pairs with a cascade of cheap tests:
+ *
+ *   APSIS FILTER (Hoots)    Two objects whose altitude ranges
+ *                           [perigee, apogee] never overlap cannot meet.
+ *
+ *   PATH FILTER (Hoots)     Two orbits in different planes can only come
+ *                           close near the line where the planes cross;
+ *                           if the orbits' radii there differ, never.
+ *
+ *          plane A  \   / plane B
+ *                    \ /
+ *          -----------X-----------  line of nodes: only here can
+ *                    / \            the objects be close
+ *
+ *   SWEPT BOXES             At each time sample, each object gets a box
+ *                           around the path it covers in the half steps
+ *                           either side; only objects whose boxes overlap
+ *                           can be close. A 3-D grid finds the overlapping
+ *                           boxes in O(n), not O(n²).
+ *
+ * The survivors are refined to the TIME OF CLOSEST APPROACH (TCA), where
+ * the range rate r_rel . v_rel crosses zero from negative to positive.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. SORT-BASED SPATIAL HASHING
+ *    - Each box is entered in every cell it touches; a radix sort on the
+ *      cell key makes each occupied cell a contiguous range
+ *
+ * 2. DUPLICATE-FREE PAIRS
+ *    - Boxes sharing several cells are paired only in the cell holding the
+ *      low corner of their overlap, so no pair is tested twice
+ *
+ * 3. FILTER CASCADES
+ *    - The cheapest, most selective test runs first; the per-pair cost of
+ *      the expensive path filter is paid only by the few that survive
+ *
+ * See also:
+ *   orbital_elements.hpp for the catalogue format
+ */
+
+#include "hohmann/conjunction.hpp"
+#include "hohmann/constants.hpp"
+#include "hohmann/root_finding.hpp"
+#include "hohmann/vector3.hpp"
+
+#include <algorithm>    // std::sort, std::min, std::max, std::clamp
+#include <array>        // std::array
+#include <cmath>        // std::sqrt, std::sin, std::cos, std::atan2, std::asin, std::floor
+#include <limits>       // std::numeric_limits
+#include <mutex>        // std::mutex, std::lock_guard
+#include <stdexcept>    // std::invalid_argument
+
+namespace hohmann {
+
+namespace {
+
+/**
+ * An elliptic orbit prepared for fast position / velocity evaluation
+ */
+struct KeplerOrbit {
+    double a, e, n, m0, b;
+    double perigee, apogee, semiLatus;
+    Vec3 p, q, normal;     // Periapsis direction, 90 deg ahead, orbit normal
+
+    KeplerOrbit(const KeplerianElements& el, double mu) {
+        a = el.semiMajorAxis;
+        e = el.eccentricity;
+        n = std::sqrt(mu / (a * a * a));
+        b = a * std::sqrt(1.0 - e * e);
+        perigee = a * (1.0 - e);
+        apogee = a * (1.0 + e);
+        semiLatus = a * (1.0 - e * e);
+        const double cO = std::cos(el.raan), sO = std::sin(el.raan);
+        const double cw = std::cos(el.argumentOfPeriapsis), sw = std::sin(el.argumentOfPeriapsis);
+        const double ci = std::cos(el.inclination), si = std::sin(el.inclination);
+        p = {cO * cw - sO * sw * ci, sO * cw + cO * sw * ci, sw * si};
+        q = {-cO * sw - sO * cw * ci, -sO * sw + cO * cw * ci, cw * si};
+        normal = {sO * si, -cO * si, ci};
+        const double nu = el.trueAnomaly;
+        const double e0 = std::atan2(std::sqrt(1.0 - e * e) * std::sin(nu), e + std::cos(nu));
+        m0 = e0 - e * std::sin(e0);
+    }
+
+    void state(double t, Vec3& r, Vec3& v) const {
+        const double m = std::remainder(m0 + n * t, math::twoPi);
+        double ecc = m + e * std::sin(m);
+        for (int iter = 0; iter < 30; ++iter) {
+            const double delta = (ecc - e * std::sin(ecc) - m) / (1.0 - e * std::cos(ecc));
+            ecc -= delta;
+            if (std::abs(delta) < 1e-13) {
+                break;
+            }
+        }
+        const double c = std::cos(ecc), s = std::sin(ecc);
+        const double radius = a * (1.0 - e * c);
+        r = (a * (c - e)) * p + (b * s) * q;
+        v = (-a * a * n * s / radius) * p + (b * a * n * c / radius) * q;
+    }
+
+    double radiusAt(double trueAnomaly) const { return semiLatus / (1.0 + e * std::cos(trueAnomaly)); }
+};
+
+struct Candidate {
+    std::uint32_t first, second;
+    std::uint32_t sample;
+};
+
+struct Counters {
+    std::uint64_t pairTests = 0, apsis = 0, motion = 0, path = 0;
+};
+
+/* Whether angle x lies within w of centre c (all in radians) */
+bool withinAngle(double x, double c, double w) {
+    return std::abs(std::remainder(x - c, math::twoPi)) <= w;
+}
+
+/* [min, max] radius of an orbit over true anomalies [c - w, c + w] */
+std::pair<double, double> radiusRange(const KeplerOrbit& o, double c, double w) {
+    double r1 = o.radiusAt(c - w), r2 = o.radiusAt(c + w);
+    double lo = std::min(r1, r2), hi = std::max(r1, r2);
+    if (withinAngle(0.0, c, w)) {
+        lo = o.perigee;
+    }
+    if (withinAngle(math::pi, c, w)) {
+        hi = o.apogee;
+    }
+    return {lo, hi};
+}
+
+/**
+ * Orbit-path filter: false only if the orbits provably never come within
+ * `threshold`. Each object must be within threshold of the other's plane,
+ * which confines it to a small arc around the mutual line of nodes; the
+ * radius ranges of both arcs must then overlap at the same node.
+ */
+bool pathsMayMeet(const KeplerOrbit& oi, const KeplerOrbit& oj, double threshold) {
+    const Vec3 line = cross(oi.normal, oj.normal);
+    const double sinI = norm(line);
+    const double limit = std::sin(math::pi / 4.0);
+    const double si = sinI > 0.0 ? threshold / (oi.perigee * sinI) : 1.0;
+    const double sj = sinI > 0.0 ? threshold / (oj.perigee * sinI) : 1.0;
+    if (si >= limit || sj >= limit) {
+        return true;    // Near-coplanar: arcs too wide to say anything
+    }
+    const double wi = std::asin(si), wj = std::asin(sj);
+    const Vec3 node = line / sinI;
+    for (double side : {1.0, -1.0}) {
+        const Vec3 dir = side * node;
+        const auto ri = radiusRange(oi, std::atan2(dot(dir, oi.q), dot(dir, oi.p)), wi);
+        const auto rj = radiusRange(oj, std::atan2(dot(dir, oj.q), dot(dir, oj.p)), wj);
+        if (ri.first - threshold <= rj.second && rj.first - threshold <= ri.second) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Range rate numerator r_rel . v_rel at time t */
+double rangeRate(const KeplerOrbit& oi, const KeplerOrbit& oj, double t) {
+    Vec3 ri, vi, rj, vj;
+    oi.state(t, ri, vi);
+    oj.state(t, rj, vj);
+    return dot(rj - ri, vj - vi);
+}
+
+/* Grid index of coordinate x, clamped so a box spans a bounded range */
+std::int64_t cellIndex(double x, double cellSize) {
+    constexpr double limit = 1 << 20;
+    return static_cast<std::int64_t>(std::clamp(std::floor(x / cellSize), -limit, limit));
+}
+
+struct CellEntry {
+    std::uint64_t key;      // Dense cell index
+    std::uint32_t index;    // Catalogue index
+    std::uint32_t starts;   // Bit a set if the box starts in this cell along axis a
+};
+
+/* A cell entry's box, with what the sweep needs to reject a pair cheaply */
+struct SweptBox {
+    Vec3 lo, hi;
+    double perigee, apogee;
+    std::uint32_t index, starts;
+};
+
+/* Stable LSD radix sort by key, for keys below 2^bits */
+void sortByKey(std::vector<CellEntry>& entries, std::vector<CellEntry>& scratch, unsigned bits) {
+    constexpr unsigned digitBits = 11;
+    constexpr std::uint64_t digitMask = (std::uint64_t{1} << digitBits) - 1;
+    std::array<std::size_t, std::size_t{1} << digitBits> offsets;
+    scratch.resize(entries.size());
+    for (unsigned shift = 0; shift < bits; shift += digitBits) {
+        offsets.fill(0);
+        for (const CellEntry& e : entries) {
+            ++offsets[(e.key >> shift) & digitMask];
+        }
+        std::size_t sum = 0;
+        for (std::size_t& offset : offsets) {
+            const std::size_t bucket = offset;
+            offset = sum;
+            sum += bucket;
+        }
+        for (const CellEntry& e : entries) {
+            scratch[offsets[(e.key >> shift) & digitMask]++] = e;
+        }
+        entries.swap(scratch);
+    }
+}
+
+} // namespace
+
+ScreeningResult screenConjunctions(const KeplerianElementsArray& catalogue, double mu,
+                                   const ScreeningOptions& options, const CancellationToken* token) {
+    if (!(options.threshold > 0.0) || !(options.duration > 0.0) || !(options.timeStep > 0.0)) {
+        throw std::invalid_argument("Threshold, duration and time step must be positive");
+    }
+    const std::size_t count = catalogue.size();
+    if (count > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("Catalogue too large (limit 2^32 - 1 objects)");
+    }
+
+    std::vector<KeplerOrbit> orbits;
+    orbits.reserve(count);
+    double minPerigee = std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < count; ++i) {
+        const KeplerianElements el = catalogue.at(i);
+        if (!(el.semiMajorAxis > 0.0) || !(el.eccentricity >= 0.0 && el.eccentricity < 1.0)) {
+            throw std::invalid_argument("Conjunction screening needs elliptic orbits");
+        }
+        orbits.emplace_back(el, mu);
+        minPerigee = std::min(minPerigee, orbits.back().perigee);
+    }
+
+    ScreeningResult result;
+    if (count < 2) {
+        return result;
+    }
+
+    // -------------------------------------------------------------------------
+    // Swept boxes: within half a step of a sample an object stays within
+    // margin / 2 of the straight segment r +- v dt / 2, so a pair can come
+    // within threshold there only if the boxes around both segments, padded
+    // by (threshold + margin) / 2, overlap. Each box is hashed into every
+    // grid cell it touches.
+    // -------------------------------------------------------------------------
+    const double dt = options.timeStep;
+    const double threshold = options.threshold;
+    const double margin = 2.0 * mu / (minPerigee * minPerigee) * dt * dt / 8.0;
+    const double pad = (threshold + margin) / 2.0;
+    const double motionLimit2 = (threshold + margin) * (threshold + margin);
+    const auto samples = static_cast<std::size_t>(std::ceil(options.duration / dt)) + 1;
+
+    std::vector<Candidate> candidates;
+    Counters totals;
+    std::size_t samplesDone = 0;
+    std::mutex mergeMutex;
+
+    TaskScheduler::global().parallelFor(0, samples, 0, [&](std::size_t firstSample, std::size_t lastSample) {
+        std::vector<Vec3> r(count), v(count), lo(count), hi(count);
+        std::vector<CellEntry> entries, scratch;
+        std::vector<SweptBox> boxes;
+        std::vector<Candidate> local;
+        Counters counters;
+        std::size_t done = 0;
+
+        for (std::size_t k = firstSample; k < lastSample; ++k) {
+            if (token && token->cancelled()) {
+                break;
+            }
+            const double t = static_cast<double>(k) * dt;
+
+            const double inf = std::numeric_limits<double>::infinity();
+            Vec3 boundsLo{inf, inf, inf}, boundsHi{-inf, -inf, -inf};
+            double reachSum = 0.0, reachMax = 0.0;
+            for (std::size_t i = 0; i < count; ++i) {
+                orbits[i].state(t, r[i], v[i]);
+                const Vec3 reach{std::abs(v[i].x) * dt / 2.0 + pad, std::abs(v[i].y) * dt / 2.0 + pad,
+                                 std::abs(v[i].z) * dt / 2.0 + pad};
+                lo[i] = r[i] - reach;
+                hi[i] = r[i] + reach;
+                boundsLo = {std::min(boundsLo.x, lo[i].x), std::min(boundsLo.y, lo[i].y),
+                            std::min(boundsLo.z, lo[i].z)};
+                boundsHi = {std::max(boundsHi.x, hi[i].x), std::max(boundsHi.y, hi[i].y),
+                            std::max(boundsHi.z, hi[i].z)};
+                reachSum += reach.x + reach.y + reach.z;
+                reachMax = std::max({reachMax, reach.x, reach.y, reach.z});
+            }
+
+            // Cells twice the mean box edge keep a box to about three cells;
+            // the floor keeps the fastest object's box to at most five per axis
+            const double cellSize = std::max(4.0 * reachSum / (3.0 * static_cast<double>(count)),
+                                             reachMax / 2.0);
+            const std::int64_t x0 = cellIndex(boundsLo.x, cellSize);
+            const std::int64_t y0 = cellIndex(boundsLo.y, cellSize);
+            const std::int64_t z0 = cellIndex(boundsLo.z, cellSize);
+            const auto nx = static_cast<std::uint64_t>(cellIndex(boundsHi.x, cellSize) - x0 + 1);
+            const auto ny = static_cast<std::uint64_t>(cellIndex(boundsHi.y, cellSize) - y0 + 1);
+            const auto nz = static_cast<std::uint64_t>(cellIndex(boundsHi.z, cellSize) - z0 + 1);
+            auto cellKey = [&](std::int64_t ix, std::int64_t iy, std::int64_t iz) {
+                return (static_cast<std::uint64_t>(iz - z0) * ny + static_cast<std::uint64_t>(iy - y0)) * nx
+                       + static_cast<std::uint64_t>(ix - x0);
+            };
+            unsigned keyBits = 0;
+            while (keyBits < 64 && (std::uint64_t{1} << keyBits) < nx * ny * nz) {
+                ++keyBits;
+            }
+
+            // One entry per cell a box touches, grouped by cell; within a
+            // cell the sort is stable, so catalogue indices ascend
+            entries.clear();
+            for (std::size_t i = 0; i < count; ++i) {
+                const std::int64_t ix0 = cellIndex(lo[i].x, cellSize), ix1 = cellIndex(hi[i].x, cellSize);
+                const std::int64_t iy0 = cellIndex(lo[i].y, cellSize), iy1 = cellIndex(hi[i].y, cellSize);
+                const std::int64_t iz0 = cellIndex(lo[i].z, cellSize), iz1 = cellIndex(hi[i].z, cellSize);
+                for (std::int64_t iz = iz0; iz <= iz1; ++iz) {
+                    for (std::int64_t iy = iy0; iy <= iy1; ++iy) {
+                        for (std::int64_t ix = ix0; ix <= ix1; ++ix) {
+                            const std::uint32_t starts = (ix == ix0 ? 1u : 0u) | (iy == iy0 ? 2u : 0u)
+                                                         | (iz == iz0 ? 4u : 0u);
+                            entries.push_back({cellKey(ix, iy, iz), static_cast<std::uint32_t>(i), starts});
+                        }
+                    }
+                }
+            }
+            sortByKey(entries, scratch, keyBits);
+
+            // Gather boxes in cell order so the sweep below reads contiguous memory
+            boxes.resize(entries.size());
+            for (std::size_t x = 0; x < entries.size(); ++x) {
+                const std::uint32_t i = entries[x].index;
+                boxes[x] = {lo[i], hi[i], orbits[i].perigee, orbits[i].apogee, i, entries[x].starts};
+            }
+
+            auto test = [&](const SweptBox& a, const SweptBox& b) {
+                ++counters.pairTests;
+                if (a.perigee - threshold > b.apogee || b.perigee - threshold > a.apogee) {
+                    ++counters.apsis;
+                    return;
+                }
+                const std::uint32_t i = a.index, j = b.index;
+                const Vec3 rho = r[j] - r[i];
+                const Vec3 w = v[j] - v[i];
+                const double w2 = dot(w, w);
+                const double tau = w2 > 0.0 ? std::clamp(-dot(rho, w) / w2, -dt / 2.0, dt / 2.0) : 0.0;
+                const Vec3 closest = rho + tau * w;
+                if (dot(closest, closest) > motionLimit2) {
+                    ++counters.motion;
+                    return;
+                }
+                if (!pathsMayMeet(orbits[i], orbits[j], threshold)) {
+                    ++counters.path;
+                    return;
+                }
+                local.push_back({i, j, static_cast<std::uint32_t>(k)});
+            };
+
+            // Within each cell, test the pairs whose boxes overlap. A pair
+            // sharing several cells is tested only in the one holding the low
+            // corner of the overlap, i.e. where along every axis one of the
+            // two boxes starts
+            for (std::size_t begin = 0; begin < entries.size();) {
+                const std::uint64_t key = entries[begin].key;
+                std::size_t end = begin + 1;
+                while (end < entries.size() && entries[end].key == key) {
+                    ++end;
+                }
+                for (std::size_t x = begin; x < end; ++x) {
+                    const SweptBox& a = boxes[x];
+                    for (std::size_t y = x + 1; y < end; ++y) {
+                        const SweptBox& b = boxes[y];
+                        // Non-short-circuit & keeps this hot test free of branches
+                        const bool overlap = ((a.starts | b.starts) == 7u) & (a.lo.x <= b.hi.x) &
+                                             (b.lo.x <= a.hi.x) & (a.lo.y <= b.hi.y) & (b.lo.y <= a.hi.y) &
+                                             (a.lo.z <= b.hi.z) & (b.lo.z <= a.hi.z);
+                        if (overlap) {
+                            test(a, b);
+                        }
+                    }
+                }
+                begin = end;
+            }
+            ++done;
+        }
+
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        candidates.insert(candidates.end(), local.begin(), local.end());
+        totals.pairTests += counters.pairTests;
+        totals.apsis += counters.apsis;
+        totals.motion += counters.motion;
+        totals.path += counters.path;
+        samplesDone += done;
+    }, token);
+
+    result.stats.pairTests = totals.pairTests;
+    result.stats.apsisRejections = totals.apsis;
+    result.stats.motionRejections = totals.motion;
+    result.stats.pathRejections = totals.path;
+    result.stats.candidates = candidates.size();
+
+    // -------------------------------------------------------------------------
+    // Group consecutive samples of a pair into runs, then refine each run
+    // -------------------------------------------------------------------------
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        if (a.first != b.first) {
+            return a.first < b.first;
+        }
+        if (a.second != b.second) {
+            return a.second < b.second;
+        }
+        return a.sample < b.sample;
+    });
+    struct Run {
+        std::uint32_t first, second, fromSample, toSample;
+    };
+    std::vector<Run> runs;
+    std::size_t runsDone = 0;
+    for (const Candidate& c : candidates) {
+        if (!runs.empty() && runs.back().first == c.first && runs.back().second == c.second
+            && c.sample <= runs.back().toSample + 1) {
+            runs.back().toSample = c.sample;
+        } else {
+            runs.push_back({c.first, c.second, c.sample, c.sample});
+        }
+    }
+
+    TaskScheduler::global().parallelFor(0, runs.size(), 64, [&](std::size_t first, std::size_t last) {
+        std::vector<Conjunction> local;
+        for (std::size_t idx = first; idx < last; ++idx) {
+            const Run& run = runs[idx];
+            const KeplerOrbit& oi = orbits[run.first];
+            const KeplerOrbit& oj = orbits[run.second];
+            const double from = std::max(0.0, run.fromSample * dt - dt);
+            const double to = std::min(options.duration, run.toSample * dt + dt);
+            const double spacing = dt / 2.0;
+            double t0 = from;
+            double f0 = rangeRate(oi, oj, t0);
+            while (t0 < to) {
+                const double t1 = std::min(to, t0 + spacing);
+                const double f1 = rangeRate(oi, oj, t1);
+                if (f0 < 0.0 && f1 >= 0.0 && !(f1 == 0.0 && t1 == options.duration)) {
+                    auto rate = [&](double t) { return rangeRate(oi, oj, t); };
+                    const double tca = illinoisRoot(rate, t0, f0, t1, f1, 1e-7);
+                    Vec3 ri, vi, rj, vj;
+                    oi.state(tca, ri, vi);
+                    oj.state(tca, rj, vj);
+                    const double miss = norm(rj - ri);
+                    if (miss <= threshold) {
+                        local.push_back({run.first, run.second, tca, miss, norm(vj - vi)});
+                    }
+                }
+                t0 = t1;
+                f0 = f1;
+            }
+        }
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        result.conjunctions.insert(result.conjunctions.end(), local.begin(), local.end());
+        runsDone += last - first;
+    }, token);
+    result.complete = samplesDone == samples && runsDone == runs.size();
+
+    // Overlapping windows of neighbouring runs can find a minimum twice
+    auto& found = result.conjunctions;
+    std::sort(found.begin(), found.end(), [](const Conjunction& a, const Conjunction& b) {
+        if (a.first != b.first) {
+            return a.first < b.first;
+        }
+        if (a.second != b.second) {
+            return a.second < b.second;
+        }
+        return a.tca < b.tca;
+    });
+    found.erase(std::unique(found.begin(), found.end(), [](const Conjunction& a, const Conjunction& b) {
+        return a.first == b.first && a.second == b.second && std::abs(a.tca - b.tca) < 1e-3;
+    }), found.end());
+    std::sort(found.begin(), found.end(), [](const Conjunction& a, const Conjunction& b) {
+        if (a.tca != b.tca) {
+            return a.tca < b.tca;
+        }
+        return a.first < b.first || (a.first == b.first && a.second < b.second);
+    });
+    return result;
+}
+
+} // namespace hohmann
@@ -0,0 +1,495 @@
+/*
+ * cr3bp.cpp - Circular restricted three-body problem
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Three-Body Dynamics and Libration Orbits
+ * ==============================================================================
+ *
+ * Between the Earth and the Moon a spacecraft feels both bodies at once, so
+ * two-body conics (and Hohmann transfers) stop being accurate. The circular
+ * restricted three-body problem (CR3BP) assumes the two primaries circle
+ * their barycenter and the spacecraft is massless. In a frame rotating with
+ * the primaries everything is time-invariant:
+ *
+ *   x'' - 2 y' = dU/dx        U = (x² + y²) / 2 + (1 - mu) / r1 + mu / r2
+ *   y'' + 2 x' = dU/dy
+ *   z''        = dU/dz
+ *
+ * Five equilibria exist - the Lagrange points:
+ *
+ *              L4
+ *
+ *     L3      Earth     L1  Moon  L2
+ *
+ *              L5
+ *
+ * L1 and L2 are unstable saddles, but families of periodic orbits surround
+ * them: planar Lyapunov orbits and, above a critical size, 3-D halo orbits
+ * (Gateway's NRHO is a member of the L2 southern halo family).
+ *
+ * FINDING THEM: every member is symmetric about the x-z plane, so it starts
+ * on y = 0 with vx = vz = 0 and must cross y = 0 again half a period later
+ * with vx = vz = 0 again. Differential correction integrates the 6x6
+ * state-transition matrix (STM) alongside the state and uses it as the
+ * Jacobian of a Newton iteration on those crossing conditions.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. ALLOCATION-FREE VARIATIONAL INTEGRATION
+ *    - State + STM is one std::array<double, 42>; the integrator in
+ *      ode.hpp is a template, so the whole Newton iteration runs on the stack
+ *
+ * 2. COARSE-TO-FINE PARALLEL CONTINUATION
+ *    - Continuation is inherently sequential, so a sparse coarse chain is
+ *      computed first and the segments between coarse members - which are
+ *      independent - are filled in parallel
+ *
+ * See also:
+ *   ode.hpp for the Dormand-Prince integrator and event location
+ */
+
+#include "hohmann/cr3bp.hpp"
+#include "hohmann/constants.hpp"
+#include "hohmann/scheduler.hpp"
+
+#include <algorithm>    // std::min
+#include <cmath>        // std::sqrt, std::abs, std::pow
+#include <stdexcept>    // std::invalid_argument
+
+namespace hohmann {
+
+namespace {
+
+constexpr double crossingTolerance = 1e-11;  // |vx|, |vz| at the half-period crossing
+constexpr int maxCorrections = 30;
+
+struct PotentialDerivatives {
+    double ux, uy, uz;
+    double uxx, uyy, uzz, uxy, uxz, uyz;
+};
+
+PotentialDerivatives potential(double mu, double x, double y, double z, bool withHessian) {
+    const double dx1 = x + mu;
+    const double dx2 = x - 1.0 + mu;
+    const double r1sq = dx1 * dx1 + y * y + z * z;
+    const double r2sq = dx2 * dx2 + y * y + z * z;
+    const double r1 = std::sqrt(r1sq), r2 = std::sqrt(r2sq);
+    const double a = (1.0 - mu) / (r1sq * r1);   // (1 - mu) / r1³
+    const double b = mu / (r2sq * r2);           // mu / r2³
+
+    PotentialDerivatives d{};
+    d.ux = x - a * dx1 - b * dx2;
+    d.uy = y - a * y - b * y;
+    d.uz = -a * z - b * z;
+    if (withHessian) {
+        const double a5 = 3.0 * a / r1sq;        // 3 (1 - mu) / r1⁵
+        const double b5 = 3.0 * b / r2sq;        // 3 mu / r2⁵
+        d.uxx = 1.0 - a - b + a5 * dx1 * dx1 + b5 * dx2 * dx2;
+        d.uyy = 1.0 - a - b + (a5 + b5) * y * y;
+        d.uzz = -a - b + (a5 + b5) * z * z;
+        d.uxy = (a5 * dx1 + b5 * dx2) * y;
+        d.uxz = (a5 * dx1 + b5 * dx2) * z;
+        d.uyz = (a5 + b5) * y * z;
+    }
+    return d;
+}
+
+/* State plus STM: dPhi/dt = A Phi with A = [0 I; Uhess Omega] */
+void variationalDerivative(double mu, const Cr3bpVariational& s, Cr3bpVariational& d) {
+    const PotentialDerivatives p = potential(mu, s[0], s[1], s[2], true);
+    d[0] = s[3];
+    d[1] = s[4];
+    d[2] = s[5];
+    d[3] = 2.0 * s[4] + p.ux;
+    d[4] = -2.0 * s[3] + p.uy;
+    d[5] = p.uz;
+
+    const double* phi = s.data() + 6;
+    double* dphi = d.data() + 6;
+    for (int j = 0; j < 6; ++j) {
+        const double p0 = phi[j], p1 = phi[6 + j], p2 = phi[12 + j];
+        const double p3 = phi[18 + j], p4 = phi[24 + j];
+        dphi[j] = p3;
+        dphi[6 + j] = p4;
+        dphi[12 + j] = phi[30 + j];
+        dphi[18 + j] = p.uxx * p0 + p.uxy * p1 + p.uxz * p2 + 2.0 * p4;
+        dphi[24 + j] = p.uxy * p0 + p.uyy * p1 + p.uyz * p2 - 2.0 * p3;
+        dphi[30 + j] = p.uxz * p0 + p.uyz * p1 + p.uzz * p2;
+    }
+}
+
+/* Root of dU/dx on the x axis between two bounds (exclusive), by bisection */
+double collinearPoint(double mu, double lo, double hi) {
+    double f_lo = potential(mu, lo, 0.0, 0.0, false).ux;
+    for (int iter = 0; iter < 200; ++iter) {
+        double mid = 0.5 * (lo + hi);
+        double f_mid = potential(mu, mid, 0.0, 0.0, false).ux;
+        if ((f_mid < 0.0) == (f_lo < 0.0)) {
+            lo = mid;
+            f_lo = f_mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return 0.5 * (lo + hi);
+}
+
+bool isHalo(PeriodicFamily family) {
+    return family != PeriodicFamily::PlanarLyapunov;
+}
+
+/* Index of the natural parameter in the initial state: x0 or z0 */
+std::size_t parameterIndex(PeriodicFamily family) {
+    return isHalo(family) ? 2 : 0;
+}
+
+} // namespace
+
+Cr3bpSystem::Cr3bpSystem(const CelestialBody& primary, const CelestialBody& secondary,
+                         double distance) {
+    if (!(distance > 0.0)) {
+        throw std::invalid_argument("CR3BP primary separation must be positive");
+    }
+    if (!(secondary.gm() > 0.0 && secondary.gm() < primary.gm())) {
+        throw std::invalid_argument("CR3BP secondary must be lighter than the primary");
+    }
+    const double total = primary.gm() + secondary.gm();
+    m_mu = secondary.gm() / total;
+    m_length = distance;
+    m_time = std::sqrt(distance * distance * distance / total);
+}
+
+Cr3bpSystem Cr3bpSystem::EarthMoon() {
+    return Cr3bpSystem(CelestialBody::Earth(), CelestialBody::Moon(), orbitalRadius::moon);
+}
+
+Vec3 Cr3bpSystem::lagrangePoint(LagrangePoint point) const {
+    const double mu = m_mu;
+    switch (point) {
+        case LagrangePoint::L1: return {collinearPoint(mu, -mu + 1e-9, 1.0 - mu - 1e-9), 0.0, 0.0};
+        case LagrangePoint::L2: return {collinearPoint(mu, 1.0 - mu + 1e-9, 2.0), 0.0, 0.0};
+        case LagrangePoint::L3: return {collinearPoint(mu, -2.0, -mu - 1e-9), 0.0, 0.0};
+        case LagrangePoint::L4: return {0.5 - mu, std::sqrt(3.0) / 2.0, 0.0};
+        case LagrangePoint::L5: break;
+    }
+    return {0.5 - mu, -std::sqrt(3.0) / 2.0, 0.0};
+}
+
+double Cr3bpSystem::jacobiConstant(const Cr3bpState& s) const {
+    const double r1 = std::sqrt((s[0] + m_mu) * (s[0] + m_mu) + s[1] * s[1] + s[2] * s[2]);
+    const double r2 = std::sqrt((s[0] - 1.0 + m_mu) * (s[0] - 1.0 + m_mu) + s[1] * s[1] + s[2] * s[2]);
+    const double u = 0.5 * (s[0] * s[0] + s[1] * s[1]) + (1.0 - m_mu) / r1 + m_mu / r2;
+    return 2.0 * u - (s[3] * s[3] + s[4] * s[4] + s[5] * s[5]);
+}
+
+void Cr3bpSystem::derivative(const Cr3bpState& s, Cr3bpState& d) const {
+    const PotentialDerivatives p = potential(m_mu, s[0], s[1], s[2], false);
+    d[0] = s[3];
+    d[1] = s[4];
+    d[2] = s[5];
+    d[3] = 2.0 * s[4] + p.ux;
+    d[4] = -2.0 * s[3] + p.uy;
+    d[5] = p.uz;
+}
+
+std::optional<Cr3bpState> Cr3bpSystem::propagate(const Cr3bpState& state, double duration) const {
+    Cr3bpState y = state;
+    double t = 0.0;
+    auto rhs = [this](double, const Cr3bpState& s, Cr3bpState& d) { derivative(s, d); };
+    if (!integrateOde(rhs, t, y, duration)) {
+        return std::nullopt;
+    }
+    return y;
+}
+
+Cr3bpVariational Cr3bpSystem::withIdentityStm(const Cr3bpState& state) {
+    Cr3bpVariational y{};
+    for (int i = 0; i < 6; ++i) {
+        y[i] = state[i];
+        y[6 + 7 * i] = 1.0;
+    }
+    return y;
+}
+
+std::optional<Cr3bpVariational> Cr3bpSystem::propagateVariational(const Cr3bpVariational& start,
+                                                                  double duration) const {
+    Cr3bpVariational y = start;
+    double t = 0.0;
+    auto rhs = [mu = m_mu](double, const Cr3bpVariational& s, Cr3bpVariational& d) {
+        variationalDerivative(mu, s, d);
+    };
+    if (!integrateOde(rhs, t, y, duration)) {
+        return std::nullopt;
+    }
+    return y;
+}
+
+PeriodicOrbit periodicOrbitGuess(const Cr3bpSystem& system, LagrangePoint point,
+                                 PeriodicFamily family, double amplitude) {
+    if (point != LagrangePoint::L1 && point != LagrangePoint::L2) {
+        throw std::invalid_argument("Periodic orbit families are generated about L1 or L2");
+    }
+    const double mu = system.massRatio();
+    const double xL = system.lagrangePoint(point).x;
+    const double gamma = std::abs(xL - (1.0 - mu));  // Distance from the secondary
+
+    // Legendre coefficients of the potential expanded about the point
+    auto c = [&](int n) {
+        const double sign = (n % 2 == 0) ? 1.0 : -1.0;
+        if (point == LagrangePoint::L1) {
+            return (mu + sign * (1.0 - mu) * std::pow(gamma / (1.0 - gamma), n + 1)) / (gamma * gamma * gamma);
+        }
+        return sign * (mu + (1.0 - mu) * std::pow(gamma / (1.0 + gamma), n + 1)) / (gamma * gamma * gamma);
+    };
+    const double c2 = c(2), c3 = c(3), c4 = c(4);
+
+    // In-plane frequency and amplitude ratio of the linearized motion
+    const double lambda = std::sqrt(0.5 * ((2.0 - c2) + std::sqrt((c2 - 2.0) * (c2 - 2.0)
+                                                              + 4.0 * (c2 - 1.0) * (1.0 + 2.0 * c2))));
+    const double k = 2.0 * lambda / (lambda * lambda + 1.0 - c2);
+
+    if (!isHalo(family)) {
+        const double ax = amplitude;
+        Cr3bpState s{xL - ax, 0.0, 0.0, 0.0, k * lambda * ax, 0.0};
+        double period = math::twoPi / lambda;
+        return {s, period, system.jacobiConstant(s)};
+    }
+
+    // Richardson (1980) third-order halo approximation, lengths in units of gamma
+    const double l2sq = lambda * lambda;
+    const double delta = l2sq - c2;
+    const double d1 = 3.0 * l2sq / k * (k * (6.0 * l2sq - 1.0) - 2.0 * lambda);
+    const double d2 = 8.0 * l2sq / k * (k * (11.0 * l2sq - 1.0) - 2.0 * lambda);
+    const double a21 = 3.0 * c3 * (k * k - 2.0) / (4.0 * (1.0 + 2.0 * c2));
+    const double a22 = 3.0 * c3 / (4.0 * (1.0 + 2.0 * c2));
+    const double a23 = -3.0 * c3 * lambda / (4.0 * k * d1) * (3.0 * k * k * k * lambda - 6.0 * k * (k - lambda) + 4.0);
+    const double a24 = -3.0 * c3 * lambda / (4.0 * k * d1) * (2.0 + 3.0 * k * lambda);
+    const double b21 = -3.0 * c3 * lambda / (2.0 * d1) * (3.0 * k * lambda - 4.0);
+    const double b22 = 3.0 * c3 * lambda / d1;
+    const double d21 = -c3 / (2.0 * l2sq);
+    const double a31 = -9.0 * lambda / (4.0 * d2) * (4.0 * c3 * (k * a23 - b21) + k * c4 * (4.0 + k * k))
+                     + (9.0 * l2sq + 1.0 - c2) / (2.0 * d2) * (3.0 * c3 * (2.0 * a23 - k * b21) + c4 * (2.0 + 3.0 * k * k));
+    const double a32 = -1.0 / d2 * (9.0 * lambda / 4.0 * (4.0 * c3 * (k * a24 - b22) + k * c4)
+                     + 1.5 * (9.0 * l2sq + 1.0 - c2) * (c3 * (k * b22 + d21 - 2.0 * a24) - c4));
+    const double b31 = 3.0 / (8.0 * d2) * (8.0 * lambda * (3.0 * c3 * (k * b21 - 2.0 * a23) - c4 * (2.0 + 3.0 * k * k))
+                     + (9.0 * l2sq + 1.0 + 2.0 * c2) * (4.0 * c3 * (k * a23 - b21) + k * c4 * (4.0 + k * k)));
+    const double b32 = 1.0 / d2 * (9.0 * lambda * (c3 * (k * b22 + d21 - 2.0 * a24) - c4)
+                     + 3.0 / 8.0 * (9.0 * l2sq + 1.0 + 2.0 * c2) * (4.0 * c3 * (k * a24 - b22) + k * c4));
+    const double d31 = 3.0 / (64.0 * l2sq) * (4.0 * c3 * a24 + c4);
+    const double d32 = 3.0 / (64.0 * l2sq) * (4.0 * c3 * (a23 - d21) + c4 * (4.0 + k * k));
+    const double sDen = 2.0 * lambda * (lambda * (1.0 + k * k) - 2.0 * k);
+    const double s1 = (1.5 * c3 * (2.0 * a21 * (k * k - 2.0) - a23 * (k * k + 2.0) - 2.0 * k * b21)
+                     - 3.0 / 8.0 * c4 * (3.0 * k * k * k * k - 8.0 * k * k + 8.0)) / sDen;
+    const double s2 = (1.5 * c3 * (2.0 * a22 * (k * k - 2.0) + a24 * (k * k + 2.0) + 2.0 * k * b22 + 5.0 * d21)
+                     + 3.0 / 8.0 * c4 * (12.0 - k * k)) / sDen;
+    const double l1 = -1.5 * c3 * (2.0 * a21 + a23 + 5.0 * d21) - 3.0 / 8.0 * c4 * (12.0 - k * k) + 2.0 * l2sq * s1;
+    const double l2 = 1.5 * c3 * (a24 - 2.0 * a22) + 9.0 / 8.0 * c4 + 2.0 * l2sq * s2;
+
+    const double az = std::abs(amplitude) / gamma;
+    const double axSq = -(l2 * az * az + delta) / l1;
+    if (!(axSq > 0.0)) {
+        throw std::invalid_argument("Halo amplitude is below the family's bifurcation");
+    }
+    const double ax = std::sqrt(axSq);
+    const double omega = 1.0 + s1 * axSq + s2 * az * az;
+    const double dm = family == PeriodicFamily::NorthernHalo ? 1.0 : -1.0;
+
+    // Evaluate at tau1 = 0 (the x-z plane crossing)
+    const double x = a21 * axSq + a22 * az * az - ax + (a23 * axSq - a24 * az * az)
+                   + (a31 * axSq * ax - a32 * ax * az * az);
+    const double z = dm * az + dm * d21 * ax * az * (1.0 - 3.0) + dm * (d32 * az * axSq - d31 * az * az * az);
+    const double dy = k * ax + 2.0 * (b21 * axSq - b22 * az * az) + 3.0 * (b31 * axSq * ax - b32 * ax * az * az);
+
+    Cr3bpState s{xL + gamma * x, 0.0, gamma * z, 0.0, gamma * lambda * omega * dy, 0.0};
+    double period = math::twoPi / (lambda * omega);
+    return {s, period, system.jacobiConstant(s)};
+}
+
+namespace {
+
+/* Converged orbit plus d(initialState)/d(natural parameter) along the family */
+struct CorrectedMember {
+    PeriodicOrbit orbit;
+    Cr3bpState tangent;
+};
+
+/**
+ * Newton iteration on the half-period crossing conditions. The Jacobian of
+ * the last (converged) iteration also gives the family tangent: how the
+ * free variables must change to stay periodic when the natural parameter
+ * moves.
+ */
+std::optional<CorrectedMember> correctMember(const Cr3bpSystem& system, const PeriodicOrbit& guess,
+                                             PeriodicFamily family) {
+    const double mu = system.massRatio();
+    const bool halo = isHalo(family);
+    auto rhs = [mu](double, const Cr3bpVariational& s, Cr3bpVariational& d) {
+        variationalDerivative(mu, s, d);
+    };
+    auto crossing = [](double, const Cr3bpVariational& s) { return s[1]; };
+
+    Cr3bpState state = guess.initialState;
+    state[1] = 0.0;
+    state[3] = 0.0;
+    state[5] = 0.0;
+    if (!halo) {
+        state[2] = 0.0;
+    }
+    double tMax = guess.period;
+
+    for (int iter = 0; iter < maxCorrections; ++iter) {
+        Cr3bpVariational y = Cr3bpSystem::withIdentityStm(state);
+        double t = 0.0;
+        if (!integrateToEvent(rhs, t, y, tMax, crossing)) {
+            return std::nullopt;
+        }
+        const double vx = y[3], vy = y[4], vz = y[5];
+        if (vy == 0.0) {
+            return std::nullopt;
+        }
+
+        // Sensitivities of the crossing velocities, with the crossing time
+        // adjusted to keep y = 0: d(v)/d(s0)[j] = Phi(v, j) - a * Phi(y, j) / vy
+        const PotentialDerivatives p = potential(mu, y[0], y[1], y[2], false);
+        const double ax = 2.0 * vy + p.ux;
+        const double az = p.uz;
+        auto dvx = [&](int col) { return y[6 + 18 + col] - ax * y[6 + 6 + col] / vy; };
+        auto dvz = [&](int col) { return y[6 + 30 + col] - az * y[6 + 6 + col] / vy; };
+        const bool converged = std::abs(vx) < crossingTolerance && std::abs(vz) < crossingTolerance;
+
+        if (!halo) {
+            // Free: vy0. Parameter: x0
+            const double slope = dvx(4);
+            if (slope == 0.0) {
+                return std::nullopt;
+            }
+            if (converged) {
+                Cr3bpState tangent{};
+                tangent[0] = 1.0;
+                tangent[4] = -dvx(0) / slope;
+                return CorrectedMember{{state, 2.0 * t, system.jacobiConstant(state)}, tangent};
+            }
+            state[4] -= vx / slope;
+        } else {
+            // Free: x0, vy0. Parameter: z0
+            const double m00 = dvx(0), m01 = dvx(4), m10 = dvz(0), m11 = dvz(4);
+            const double det = m00 * m11 - m01 * m10;
+            if (det == 0.0) {
+                return std::nullopt;
+            }
+            auto solve = [&](double bx, double bz, double& d0, double& d4) {
+                d0 = (bx * m11 - bz * m01) / det;
+                d4 = (bz * m00 - bx * m10) / det;
+            };
+            if (converged) {
+                Cr3bpState tangent{};
+                tangent[2] = 1.0;
+                solve(-dvx(2), -dvz(2), tangent[0], tangent[4]);
+                return CorrectedMember{{state, 2.0 * t, system.jacobiConstant(state)}, tangent};
+            }
+            double d0 = 0.0, d4 = 0.0;
+            solve(-vx, -vz, d0, d4);
+            state[0] += d0;
+            state[4] += d4;
+        }
+        tMax = 3.0 * t;
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+std::optional<PeriodicOrbit> correctPeriodicOrbit(const Cr3bpSystem& system,
+                                                  const PeriodicOrbit& guess,
+                                                  PeriodicFamily family) {
+    auto member = correctMember(system, guess, family);
+    if (!member) {
+        return std::nullopt;
+    }
+    return member->orbit;
+}
+
+std::vector<PeriodicOrbit> continueFamily(const Cr3bpSystem& system, const PeriodicOrbit& seed,
+                                          PeriodicFamily family, ContinuationOptions options) {
+    if (options.step == 0.0 || options.coarseStride == 0) {
+        throw std::invalid_argument("Continuation step and coarse stride must be non-zero");
+    }
+    const std::size_t members = options.members;
+    const std::size_t stride = options.coarseStride;
+    const std::size_t param = parameterIndex(family);
+    if (members == 0) {
+        return {};
+    }
+
+    // Re-correct the seed to obtain its tangent
+    std::vector<std::optional<CorrectedMember>> chain(members);
+    chain[0] = correctMember(system, seed, family);
+    if (!chain[0]) {
+        return {};
+    }
+    const double p0 = chain[0]->orbit.initialState[param];
+
+    // Tangent predictor in the natural parameter, then correct
+    auto nextMember = [&](const CorrectedMember& prev, std::size_t index) {
+        PeriodicOrbit guess = prev.orbit;
+        const double dp = p0 + static_cast<double>(index) * options.step - prev.orbit.initialState[param];
+        for (std::size_t i = 0; i < 6; ++i) {
+            guess.initialState[i] += dp * prev.tangent[i];
+        }
+        return correctMember(system, guess, family);
+    };
+
+    // Coarse chain, sequential. A coarse jump that fails to converge is
+    // retried by marching through the fine members in between, which also
+    // completes that segment.
+    std::vector<char> segmentDone(members / stride + 1, 0);
+    std::size_t lastCoarse = 0;
+    bool familyEnded = false;
+    for (std::size_t k = stride; k < members && !familyEnded; k += stride) {
+        chain[k] = nextMember(*chain[k - stride], k);
+        if (!chain[k]) {
+            for (std::size_t j = k - stride + 1; j <= k; ++j) {
+                chain[j] = nextMember(*chain[j - 1], j);
+                if (!chain[j]) {
+                    familyEnded = true;
+                    break;
+                }
+            }
+            segmentDone[k / stride - 1] = 1;
+        }
+        if (!familyEnded) {
+            lastCoarse = k;
+        }
+    }
+
+    // Remaining fine segments after each coarse member, in parallel
+    const std::size_t segments = lastCoarse / stride + 1;
+    TaskScheduler::global().parallelFor(0, segments, 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t seg = first; seg < last; ++seg) {
+            if (segmentDone[seg]) {
+                continue;
+            }
+            const std::size_t k0 = seg * stride;
+            const std::size_t end = std::min(k0 + stride, members);
+            for (std::size_t k = k0 + 1; k < end; ++k) {
+                chain[k] = nextMember(*chain[k - 1], k);
+                if (!chain[k]) {
+                    break;
+                }
+            }
+        }
+    });
+
+    std::vector<PeriodicOrbit> result;
+    for (const auto& member : chain) {
+        if (!member) {
+            break;
+        }
+        result.push_back(member->orbit);
+    }
+    return result;
+}
+
+} // namespace hohmann
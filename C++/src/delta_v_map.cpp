@@ -0,0 +1,659 @@
+/*
+ * delta_v_map.cpp - Delta-v graph of orbits and shortest-path mission planning
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: The Delta-v Subway Map
+ * ==============================================================================
+ *
+ * Mission designers summarize "how hard is it to get from A to B" as a map
+ * of stations (orbits) joined by lines labelled with the delta-v to ride
+ * between them:
+ *
+ *        LEO --2.4-- GTO --1.8-- GEO          (km/s)
+ *         |           |
+ *        3.1         0.7
+ *         |           |
+ *        HEO ---------'      HEO = perigee in LEO, apogee at the Moon
+ *         |   \
+ *        0.8   1.4
+ *         |      \
+ *        LLO     Mars capture --1.2-- LMO
+ *
+ * Because impulsive maneuvers are additive, the cheapest mission is the
+ * cheapest path through that graph, and the graph makes the non-obvious
+ * routes visible: going to GEO via GTO with the plane change folded into
+ * the apogee burn is ~1.1 km/s cheaper than climbing first and turning
+ * afterwards.
+ *
+ * Each line is priced by the engine that fits the two stations:
+ *
+ *   Same body        tangentTransfer() between the apsides (for circular
+ *                    ends this is the HohmannTransfer), plane change
+ *                    combined with the burn at the larger radius where the
+ *                    orbital speed is lowest:
+ *                      dv = sqrt(v_a² + v_b² - 2 v_a v_b cos(di))
+ *   Planet <-> moon  Hohmann in the planet's frame out to the moon's orbit;
+ *                    the speed mismatch there is the v-infinity of a
+ *                    capture hyperbola at the moon
+ *   Planet <-> planet  PatchedConicMission: heliocentric Hohmann, then
+ *                    hyperbolic departure and capture at periapsis
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. COMPRESSED SPARSE ROW (CSR) GRAPHS
+ *    - Legs are sorted by tail node; node v's legs are one contiguous slice
+ *      of parallel arrays, indexed through rowStart[v] .. rowStart[v + 1]
+ *
+ * 2. LANDMARK A* (ALT)
+ *    - Distances to and from a few far-apart landmarks give a consistent
+ *      lower bound on the remaining cost via the triangle inequality
+ *
+ * 3. GENERATION-STAMPED WORKSPACE
+ *    - A thread_local scratch area whose entries count as reset whenever
+ *      their stamp is stale, so no query clears O(n) arrays
+ *
+ * 4. YEN'S K-SHORTEST PATHS
+ *    - Each new route deviates from an accepted one at a spur node, with
+ *      the accepted routes' next legs banned
+ *
+ * See also:
+ *   transfer_kernel.hpp for tangentTransfer()
+ *   patched_conic.cpp for the hyperbolic departure and capture burns
+ */
+
+#include "hohmann/delta_v_map.hpp"
+#include "hohmann/constants.hpp"
+#include "hohmann/patched_conic.hpp"
+#include "hohmann/transfer_kernel.hpp"
+
+#include <algorithm>    // std::push_heap, std::pop_heap, std::fill, std::equal, std::reverse
+#include <cmath>        // std::sqrt, std::cos, std::abs
+#include <functional>   // std::greater
+#include <limits>       // std::numeric_limits
+#include <set>          // std::set
+#include <stdexcept>    // std::invalid_argument
+#include <utility>      // std::pair
+
+namespace hohmann {
+
+namespace {
+
+constexpr double infinity = std::numeric_limits<double>::infinity();
+constexpr std::uint32_t noLeg = std::numeric_limits<std::uint32_t>::max();
+
+/* (cost, node) min-heap entry */
+using HeapEntry = std::pair<double, std::uint32_t>;
+
+struct PricedLeg {
+    double deltaV;
+    double time;
+};
+
+double visViva(double mu, double radius, double semiMajorAxis) {
+    return std::sqrt(mu * (2.0 / radius - 1.0 / semiMajorAxis));
+}
+
+/*
+ * Same-body transfer: the cheaper tangent option between the apsides, with
+ * the plane change added to whichever burn sits at the larger radius
+ */
+PricedLeg sameBodyLeg(const MapOrbit& a, const MapOrbit& b, double mu) {
+    const double aA = 0.5 * (a.periapsisRadius + a.apoapsisRadius);
+    const double aB = 0.5 * (b.periapsisRadius + b.apoapsisRadius);
+    const double planeChange = std::abs(a.inclination - b.inclination);
+
+    auto option = [&](double r1, double r2) {
+        TransferResult t = tangentTransfer(r1, aA, r2, aB, mu);
+        if (planeChange > 0.0) {
+            // Rotate the velocity during the slower (outer) burn
+            const bool atArrival = r2 >= r1;
+            const double r = atArrival ? r2 : r1;
+            const double vOrbit = visViva(mu, r, atArrival ? aB : aA);
+            const double vTransfer = visViva(mu, r, t.semiMajorAxis);
+            const double combined = std::sqrt(vOrbit * vOrbit + vTransfer * vTransfer
+                                              - 2.0 * vOrbit * vTransfer * std::cos(planeChange));
+            (atArrival ? t.deltaV2 : t.deltaV1) = combined;
+            t.totalDeltaV = t.deltaV1 + t.deltaV2;
+        }
+        return t;
+    };
+
+    const TransferResult periToApo = option(a.periapsisRadius, b.apoapsisRadius);
+    const TransferResult apoToPeri = option(a.apoapsisRadius, b.periapsisRadius);
+    const TransferResult& best = apoToPeri.totalDeltaV < periToApo.totalDeltaV ? apoToPeri : periToApo;
+    return {best.totalDeltaV, best.transferTime};
+}
+
+double eccentricity(const MapOrbit& o) {
+    return (o.apoapsisRadius - o.periapsisRadius) / (o.apoapsisRadius + o.periapsisRadius);
+}
+
+/* Burn at the node's periapsis between its orbit and a hyperbola */
+double hyperbolicBurn(const MapOrbit& o, double vInfinity, double mu) {
+    return hyperbolicPeriapsisDeltaV(vInfinity, mu, o.periapsisRadius, eccentricity(o));
+}
+
+/*
+ * Single-source Dijkstra over a CSR graph into dist (size n, any contents)
+ */
+void dijkstraAll(const std::vector<std::uint32_t>& rowStart, const std::vector<std::uint32_t>& target,
+                 const std::vector<double>& weight, std::size_t source, double* dist) {
+    const std::size_t n = rowStart.size() - 1;
+    std::fill(dist, dist + n, infinity);
+    std::vector<HeapEntry> heap;
+    dist[source] = 0.0;
+    heap.emplace_back(0.0, static_cast<std::uint32_t>(source));
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<>());
+        const auto [d, v] = heap.back();
+        heap.pop_back();
+        if (d > dist[v]) {
+            continue;
+        }
+        for (std::uint32_t e = rowStart[v]; e < rowStart[v + 1]; ++e) {
+            const double nd = d + weight[e];
+            const std::uint32_t w = target[e];
+            if (nd < dist[w]) {
+                dist[w] = nd;
+                heap.emplace_back(nd, w);
+                std::push_heap(heap.begin(), heap.end(), std::greater<>());
+            }
+        }
+    }
+}
+
+/*
+ * Per-thread search scratch. An entry whose stamp differs from the current
+ * generation counts as (cost = infinity, parent = none).
+ */
+struct Workspace {
+    std::vector<double> cost;
+    std::vector<std::uint32_t> parentLeg;
+    std::vector<std::uint32_t> stamp;
+    std::vector<HeapEntry> heap;
+    std::uint32_t generation = 0;
+
+    void begin(std::size_t n) {
+        if (stamp.size() < n) {
+            cost.resize(n);
+            parentLeg.resize(n);
+            stamp.resize(n, 0);
+        }
+        if (++generation == 0) {
+            std::fill(stamp.begin(), stamp.end(), 0);
+            generation = 1;
+        }
+        heap.clear();
+    }
+
+    double costOf(std::uint32_t v) const { return stamp[v] == generation ? cost[v] : infinity; }
+
+    void set(std::uint32_t v, double c, std::uint32_t leg) {
+        stamp[v] = generation;
+        cost[v] = c;
+        parentLeg[v] = leg;
+    }
+};
+
+thread_local Workspace t_workspace;
+
+} // namespace
+
+// =============================================================================
+// BUILDER
+// =============================================================================
+
+std::size_t DeltaVMapBuilder::addBody(const CelestialBody& body) {
+    m_bodies.push_back({body, std::nullopt, 0.0});
+    return m_bodies.size() - 1;
+}
+
+std::size_t DeltaVMapBuilder::addBody(const CelestialBody& body, std::size_t parent, double orbitRadius) {
+    checkBody(parent);
+    if (!(orbitRadius > 0.0)) {
+        throw std::invalid_argument("Body orbit radius must be positive");
+    }
+    m_bodies.push_back({body, parent, orbitRadius});
+    return m_bodies.size() - 1;
+}
+
+std::size_t DeltaVMapBuilder::addOrbit(const std::string& name, std::size_t body, double periapsisRadius,
+                                       double apoapsisRadius, double inclination) {
+    checkBody(body);
+    if (!(periapsisRadius > 0.0) || !(apoapsisRadius >= periapsisRadius)) {
+        throw std::invalid_argument("Map orbit needs 0 < periapsis radius <= apoapsis radius");
+    }
+    m_orbits.push_back({name, body, periapsisRadius, apoapsisRadius, inclination});
+    return m_orbits.size() - 1;
+}
+
+std::size_t DeltaVMapBuilder::addCircularOrbit(const std::string& name, std::size_t body, double radius,
+                                               double inclination) {
+    return addOrbit(name, body, radius, radius, inclination);
+}
+
+void DeltaVMapBuilder::connect(std::size_t a, std::size_t b) {
+    checkNode(a);
+    checkNode(b);
+    const MapOrbit& oa = m_orbits[a];
+    const MapOrbit& ob = m_orbits[b];
+    const Body& ba = m_bodies[oa.body];
+    const Body& bb = m_bodies[ob.body];
+
+    PricedLeg priced{};
+    LegKind kind;
+    if (oa.body == ob.body) {
+        priced = sameBodyLeg(oa, ob, ba.body.gm());
+        kind = LegKind::Transfer;
+    } else if (bb.parent == oa.body || ba.parent == ob.body) {
+        // One body is the other's moon: price planet -> moon
+        const bool aIsPlanet = bb.parent == oa.body;
+        const MapOrbit& planetOrbit = aIsPlanet ? oa : ob;
+        const MapOrbit& moonOrbit = aIsPlanet ? ob : oa;
+        const Body& planet = aIsPlanet ? ba : bb;
+        const Body& moon = aIsPlanet ? bb : ba;
+        const TransferResult out = tangentTransfer(planetOrbit.periapsisRadius,
+                                                   0.5 * (planetOrbit.periapsisRadius + planetOrbit.apoapsisRadius),
+                                                   moon.orbitRadius, moon.orbitRadius, planet.body.gm());
+        priced = {out.deltaV1 + hyperbolicBurn(moonOrbit, out.deltaV2, moon.body.gm()), out.transferTime};
+        kind = LegKind::Moon;
+    } else if (ba.parent && ba.parent == bb.parent) {
+        const CelestialBody& primary = m_bodies[*ba.parent].body;
+        const PatchedConicMission mission(HohmannTransfer(Orbit(primary, ba.orbitRadius),
+                                                          Orbit(primary, bb.orbitRadius)),
+                                          ba.body, bb.body);
+        priced = {hyperbolicBurn(oa, mission.departureVInfinity(), ba.body.gm())
+                      + hyperbolicBurn(ob, mission.arrivalVInfinity(), bb.body.gm()),
+                  mission.heliocentricTransfer().result().transferTime};
+        kind = LegKind::Interplanetary;
+    } else {
+        throw std::invalid_argument("Map orbits must share a body, a planet-moon pair or a parent");
+    }
+
+    m_legs.push_back({a, b, priced.deltaV, priced.time, kind});
+    m_legs.push_back({b, a, priced.deltaV, priced.time, kind});
+}
+
+void DeltaVMapBuilder::addLeg(std::size_t from, std::size_t to, double deltaV, double time) {
+    checkNode(from);
+    checkNode(to);
+    if (!(deltaV >= 0.0) || !(time >= 0.0)) {
+        throw std::invalid_argument("Map leg delta-v and time must not be negative");
+    }
+    m_legs.push_back({from, to, deltaV, time, LegKind::Custom});
+}
+
+void DeltaVMapBuilder::checkNode(std::size_t node) const {
+    if (node >= m_orbits.size()) {
+        throw std::invalid_argument("Unknown map orbit");
+    }
+}
+
+void DeltaVMapBuilder::checkBody(std::size_t body) const {
+    if (body >= m_bodies.size()) {
+        throw std::invalid_argument("Unknown map body");
+    }
+}
+
+DeltaVMap DeltaVMapBuilder::build(std::size_t landmarks) const {
+    const std::size_t n = m_orbits.size();
+    const std::size_t m = m_legs.size();
+    DeltaVMap map;
+    map.m_orbits = m_orbits;
+
+    // Counting sort of legs by tail node
+    map.m_rowStart.assign(n + 1, 0);
+    for (const MapLeg& leg : m_legs) {
+        ++map.m_rowStart[leg.from + 1];
+    }
+    for (std::size_t v = 0; v < n; ++v) {
+        map.m_rowStart[v + 1] += map.m_rowStart[v];
+    }
+    map.m_source.resize(m);
+    map.m_target.resize(m);
+    map.m_deltaV.resize(m);
+    map.m_time.resize(m);
+    map.m_kind.resize(m);
+    std::vector<std::uint32_t> cursor(map.m_rowStart.begin(), map.m_rowStart.end() - 1);
+    for (const MapLeg& leg : m_legs) {
+        const std::uint32_t e = cursor[leg.from]++;
+        map.m_source[e] = static_cast<std::uint32_t>(leg.from);
+        map.m_target[e] = static_cast<std::uint32_t>(leg.to);
+        map.m_deltaV[e] = leg.deltaV;
+        map.m_time[e] = leg.time;
+        map.m_kind[e] = leg.kind;
+    }
+
+    // Reverse CSR, only needed for the distances to each landmark
+    std::vector<std::uint32_t> reverseStart(n + 1, 0);
+    for (std::size_t e = 0; e < m; ++e) {
+        ++reverseStart[map.m_target[e] + 1];
+    }
+    for (std::size_t v = 0; v < n; ++v) {
+        reverseStart[v + 1] += reverseStart[v];
+    }
+    std::vector<std::uint32_t> reverseTarget(m);
+    std::vector<double> reverseWeight(m);
+    std::copy(reverseStart.begin(), reverseStart.end() - 1, cursor.begin());
+    for (std::size_t e = 0; e < m; ++e) {
+        const std::uint32_t r = cursor[map.m_target[e]]++;
+        reverseTarget[r] = map.m_source[e];
+        reverseWeight[r] = map.m_deltaV[e];
+    }
+
+    // Farthest-point landmark selection: each new landmark is the node
+    // worst covered by those already chosen
+    map.m_landmarkCount = n == 0 ? 0 : std::min(landmarks, n);
+    map.m_fromLandmark.resize(map.m_landmarkCount * n);
+    map.m_toLandmark.resize(map.m_landmarkCount * n);
+    std::vector<double> coverage(n, infinity);
+    std::size_t next = 0;
+    if (n > 0) {
+        std::vector<double> seed(n);
+        dijkstraAll(map.m_rowStart, map.m_target, map.m_deltaV, 0, seed.data());
+        for (std::size_t v = 0; v < n; ++v) {
+            if (seed[v] < infinity && seed[v] > seed[next]) {
+                next = v;
+            }
+        }
+    }
+    for (std::size_t l = 0; l < map.m_landmarkCount; ++l) {
+        double* from = &map.m_fromLandmark[l * n];
+        double* to = &map.m_toLandmark[l * n];
+        dijkstraAll(map.m_rowStart, map.m_target, map.m_deltaV, next, from);
+        dijkstraAll(reverseStart, reverseTarget, reverseWeight, next, to);
+        coverage[next] = 0.0;
+        for (std::size_t v = 0; v < n; ++v) {
+            coverage[v] = std::min(coverage[v], from[v]);
+        }
+        // Unreached nodes (another component) come first, then the farthest
+        for (std::size_t v = 0; v < n; ++v) {
+            if (coverage[v] > coverage[next]) {
+                next = v;
+            }
+        }
+    }
+    return map;
+}
+
+// =============================================================================
+// QUERIES
+// =============================================================================
+
+std::optional<std::size_t> DeltaVMap::find(const std::string& name) const {
+    for (std::size_t v = 0; v < m_orbits.size(); ++v) {
+        if (m_orbits[v].name == name) {
+            return v;
+        }
+    }
+    return std::nullopt;
+}
+
+std::vector<MapLeg> DeltaVMap::legsFrom(std::size_t node) const {
+    checkNode(node);
+    std::vector<MapLeg> legs;
+    for (std::uint32_t e = m_rowStart[node]; e < m_rowStart[node + 1]; ++e) {
+        legs.push_back(leg(e));
+    }
+    return legs;
+}
+
+std::optional<MapPath> DeltaVMap::shortestPath(std::size_t source, std::size_t target) const {
+    checkNode(source);
+    checkNode(target);
+    const auto legs = search(source, target, false);
+    if (!legs) {
+        return std::nullopt;
+    }
+    return makePath(source, *legs);
+}
+
+std::optional<MapPath> DeltaVMap::shortestPathAStar(std::size_t source, std::size_t target) const {
+    checkNode(source);
+    checkNode(target);
+    const auto legs = search(source, target, true);
+    if (!legs) {
+        return std::nullopt;
+    }
+    return makePath(source, *legs);
+}
+
+std::vector<MapPath> DeltaVMap::kShortestPaths(std::size_t source, std::size_t target, std::size_t k) const {
+    checkNode(source);
+    checkNode(target);
+    std::vector<MapPath> paths;
+    if (k == 0) {
+        return paths;
+    }
+    auto first = search(source, target, true);
+    if (!first) {
+        return paths;
+    }
+
+    auto pathCost = [&](const std::vector<std::uint32_t>& legs) {
+        double total = 0.0;
+        for (std::uint32_t e : legs) {
+            total += m_deltaV[e];
+        }
+        return total;
+    };
+
+    std::vector<std::vector<std::uint32_t>> accepted{std::move(*first)};
+    // Ordered by cost, then lexicographically - which also drops duplicates
+    std::set<std::pair<double, std::vector<std::uint32_t>>> candidates;
+    std::vector<char> bannedNodes(nodeCount(), 0);
+    std::vector<char> bannedLegs(legCount(), 0);
+
+    while (accepted.size() < k) {
+        const std::vector<std::uint32_t>& last = accepted.back();
+        // Spur from every node of the last accepted route but the target
+        for (std::size_t i = 0; i < last.size(); ++i) {
+            const std::uint32_t spurNode = m_source[last[i]];
+
+            std::vector<std::uint32_t> banned;
+            for (const auto& route : accepted) {
+                if (route.size() > i && std::equal(last.begin(), last.begin() + i, route.begin())) {
+                    bannedLegs[route[i]] = 1;
+                    banned.push_back(route[i]);
+                }
+            }
+            for (std::size_t j = 0; j < i; ++j) {
+                bannedNodes[m_source[last[j]]] = 1;
+            }
+
+            // Bans only lengthen routes, so the landmark bound stays valid
+            auto spur = search(spurNode, target, true, &bannedNodes, &bannedLegs);
+            if (spur) {
+                std::vector<std::uint32_t> route(last.begin(), last.begin() + i);
+                route.insert(route.end(), spur->begin(), spur->end());
+                const double cost = pathCost(route);
+                candidates.emplace(cost, std::move(route));
+            }
+
+            for (std::uint32_t e : banned) {
+                bannedLegs[e] = 0;
+            }
+            for (std::size_t j = 0; j < i; ++j) {
+                bannedNodes[m_source[last[j]]] = 0;
+            }
+        }
+        if (candidates.empty()) {
+            break;
+        }
+        accepted.push_back(candidates.begin()->second);
+        candidates.erase(candidates.begin());
+    }
+
+    for (const auto& route : accepted) {
+        paths.push_back(makePath(source, route));
+    }
+    return paths;
+}
+
+std::vector<double> DeltaVMap::deltaVFrom(std::size_t source) const {
+    checkNode(source);
+    std::vector<double> dist(nodeCount());
+    dijkstraAll(m_rowStart, m_target, m_deltaV, source, dist.data());
+    return dist;
+}
+
+std::vector<double> DeltaVMap::deltaVTable(const CancellationToken* token) const {
+    const std::size_t n = nodeCount();
+    // Rows skipped by cancellation stay NaN; 0 would read as a free transfer
+    std::vector<double> table(n * n, std::numeric_limits<double>::quiet_NaN());
+    TaskScheduler::global().parallelFor(0, n, 1, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t v = lo; v < hi; ++v) {
+            dijkstraAll(m_rowStart, m_target, m_deltaV, v, &table[v * n]);
+        }
+    }, token);
+    return table;
+}
+
+// =============================================================================
+// SEARCH
+// =============================================================================
+
+std::optional<std::vector<std::uint32_t>> DeltaVMap::search(std::size_t source, std::size_t target,
+                                                            bool guided,
+                                                            const std::vector<char>* bannedNodes,
+                                                            const std::vector<char>* bannedLegs) const {
+    Workspace& ws = t_workspace;
+    ws.begin(nodeCount());
+    const auto t = static_cast<std::uint32_t>(target);
+    auto priority = [&](std::uint32_t v, double g) { return guided ? g + lowerBound(v, target) : g; };
+
+    ws.set(static_cast<std::uint32_t>(source), 0.0, noLeg);
+    ws.heap.emplace_back(priority(static_cast<std::uint32_t>(source), 0.0), static_cast<std::uint32_t>(source));
+    bool found = false;
+    while (!ws.heap.empty()) {
+        std::pop_heap(ws.heap.begin(), ws.heap.end(), std::greater<>());
+        const auto [f, v] = ws.heap.back();
+        ws.heap.pop_back();
+        const double g = ws.costOf(v);
+        if (f > priority(v, g)) {
+            continue;  // Stale entry
+        }
+        if (v == t) {
+            found = true;
+            break;
+        }
+        for (std::uint32_t e = m_rowStart[v]; e < m_rowStart[v + 1]; ++e) {
+            const std::uint32_t w = m_target[e];
+            if ((bannedLegs && (*bannedLegs)[e]) || (bannedNodes && (*bannedNodes)[w])) {
+                continue;
+            }
+            const double ng = g + m_deltaV[e];
+            if (ng < ws.costOf(w)) {
+                ws.set(w, ng, e);
+                ws.heap.emplace_back(priority(w, ng), w);
+                std::push_heap(ws.heap.begin(), ws.heap.end(), std::greater<>());
+            }
+        }
+    }
+    if (!found) {
+        return std::nullopt;
+    }
+
+    std::vector<std::uint32_t> legs;
+    for (std::uint32_t v = t; ws.parentLeg[v] != noLeg; v = m_source[ws.parentLeg[v]]) {
+        legs.push_back(ws.parentLeg[v]);
+    }
+    std::reverse(legs.begin(), legs.end());
+    return legs;
+}
+
+double DeltaVMap::lowerBound(std::size_t node, std::size_t target) const {
+    const std::size_t n = nodeCount();
+    double bound = 0.0;
+    for (std::size_t l = 0; l < m_landmarkCount; ++l) {
+        const double* from = &m_fromLandmark[l * n];
+        const double* to = &m_toLandmark[l * n];
+        if (from[target] < infinity && from[node] < infinity) {
+            bound = std::max(bound, from[target] - from[node]);
+        }
+        if (to[node] < infinity && to[target] < infinity) {
+            bound = std::max(bound, to[node] - to[target]);
+        }
+    }
+    return bound;
+}
+
+MapLeg DeltaVMap::leg(std::uint32_t index) const {
+    return {m_source[index], m_target[index], m_deltaV[index], m_time[index], m_kind[index]};
+}
+
+MapPath DeltaVMap::makePath(std::size_t source, const std::vector<std::uint32_t>& legs) const {
+    MapPath path;
+    path.nodes.push_back(source);
+    for (std::uint32_t e : legs) {
+        path.legs.push_back(leg(e));
+        path.nodes.push_back(m_target[e]);
+        path.deltaV += m_deltaV[e];
+        path.time += m_time[e];
+    }
+    return path;
+}
+
+void DeltaVMap::checkNode(std::size_t node) const {
+    if (node >= m_orbits.size()) {
+        throw std::invalid_argument("Unknown map orbit");
+    }
+}
+
+// =============================================================================
+// PRESET MAP
+// =============================================================================
+
+DeltaVMap DeltaVMap::innerSolarSystem() {
+    DeltaVMapBuilder b;
+    const std::size_t sun = b.addBody(CelestialBody::Sun());
+    const std::size_t venus = b.addBody(CelestialBody::Venus(), sun, orbitalRadius::venus);
+    const std::size_t earth = b.addBody(CelestialBody::Earth(), sun, orbitalRadius::earth);
+    const std::size_t moon = b.addBody(CelestialBody::Moon(), earth, orbitalRadius::moon);
+    const std::size_t mars = b.addBody(CelestialBody::Mars(), sun, orbitalRadius::mars);
+    const std::size_t jupiter = b.addBody(CelestialBody::Jupiter(), sun, orbitalRadius::jupiter);
+
+    const Orbit geoOrbit = Orbit::GEO(CelestialBody::Earth());
+    const double leoRadius = Orbit::LEO(CelestialBody::Earth()).radius();
+    const double geo = geoOrbit.radius();
+
+    const std::size_t leo = b.addCircularOrbit("LEO", earth, leoRadius, 28.5 * math::degToRad);
+    const std::size_t iss = b.addCircularOrbit("ISS", earth, Orbit::ISS(CelestialBody::Earth()).radius(),
+                                               51.6 * math::degToRad);
+    const std::size_t gto = b.addOrbit("GTO", earth, leoRadius, geo, 28.5 * math::degToRad);
+    const std::size_t geoNode = b.addCircularOrbit("GEO", earth, geo);
+    const std::size_t heo = b.addOrbit("HEO", earth, leoRadius, orbitalRadius::moon, 28.5 * math::degToRad);
+    const std::size_t llo = b.addCircularOrbit("LLO", moon, bodyRadius::moon + 100e3);
+    const std::size_t lvo = b.addCircularOrbit("LVO", venus, bodyRadius::venus + 300e3);
+    const std::size_t venusCapture = b.addOrbit("Venus capture", venus, bodyRadius::venus + 300e3,
+                                                bodyRadius::venus + 300e3 + 60e6);
+    const std::size_t lmo = b.addCircularOrbit("LMO", mars, bodyRadius::mars + 400e3);
+    const std::size_t marsCapture = b.addOrbit("Mars capture", mars, bodyRadius::mars + 400e3,
+                                               bodyRadius::mars + 400e3 + 33e6);
+    const std::size_t ljo = b.addCircularOrbit("LJO", jupiter, bodyRadius::jupiter + 1000e3);
+    const std::size_t jupiterCapture = b.addOrbit("Jupiter capture", jupiter, bodyRadius::jupiter + 1000e3,
+                                                  bodyRadius::jupiter + 1000e3 + 2e9);
+
+    b.connect(leo, iss);
+    b.connect(leo, gto);
+    b.connect(leo, geoNode);
+    b.connect(gto, geoNode);
+    b.connect(leo, heo);
+    b.connect(gto, heo);
+    b.connect(heo, llo);
+    b.connect(leo, llo);
+    b.connect(lvo, venusCapture);
+    b.connect(lmo, marsCapture);
+    b.connect(ljo, jupiterCapture);
+    for (std::size_t planetary : {venusCapture, marsCapture, jupiterCapture}) {
+        b.connect(leo, planetary);
+        b.connect(heo, planetary);
+    }
+    b.connect(marsCapture, jupiterCapture);
+    b.connect(venusCapture, marsCapture);
+    return b.build();
+}
+
+} // namespace hohmann
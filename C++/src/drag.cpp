@@ -0,0 +1,331 @@
+/*
+ * drag.cpp - Exponential atmosphere and orbit-averaged drag decay
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Orbital Decay
+ * ==============================================================================
+ *
+ * Below about 1000 km a spacecraft flies through the tenuous top of the
+ * atmosphere. Drag takes away a little energy every orbit, so the orbit
+ * shrinks - slowly at first, then faster and faster, because density
+ * grows roughly exponentially as the altitude drops:
+ *
+ *   altitude
+ *     ^
+ *  420|*****
+ *     |     *******
+ *     |            ******
+ *     |                  ****
+ *     |                      **
+ *  120|                        *  <-- reentry
+ *     +-----------------------------> time
+ *
+ * DENSITY MODEL:
+ * --------------
+ * The atmosphere is split into bands; inside each one density falls off
+ * exponentially with its own scale height H:
+ *
+ *   rho(h) = rho0 * exp(-(h - h0) / H)
+ *
+ * H grows from ~7 km near the ground to ~60 km at ISS altitude and more
+ * above, because the hot upper atmosphere is dominated by light atoms.
+ * Real densities swing by a factor of several with solar activity; the
+ * table is a moderate-activity average and can be scaled.
+ *
+ * ORBIT-AVERAGED DECAY:
+ * ---------------------
+ * Drag deceleration is a_D = 0.5 * rho * v² / B with the ballistic
+ * coefficient B = m / (Cd * A). For a circular orbit the Gauss equation
+ * da/dt = 2 a² v a_D / mu simplifies to
+ *
+ *   da/dt = -rho(h) * sqrt(mu * a) / B
+ *
+ * Separating variables, the time to fall from h to the reentry altitude is
+ *
+ *   T(h) = B * integral[h_re .. h] dh' / (rho(h') * sqrt(mu * (R + h')))
+ *                     \________________________________________/
+ *                              depends on the atmosphere only
+ *
+ * Typical numbers for Earth (moderate activity):
+ *   ISS (420 km, B ~ 150 kg/m²):   ~2 km lost per month without reboost
+ *   CubeSat (400 km, B ~ 20 kg/m²): about two months
+ *   800 km:                         decades to centuries
+ *
+ * REBOOST:
+ * --------
+ * Holding altitude means cancelling drag: the delta-v per unit time is the
+ * drag deceleration itself, 0.5 * rho * v² / B. For the ISS that is
+ * 15-20 m/s per year at moderate solar activity.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. PRECOMPUTING WHAT THE BATCH SHARES
+ *    - The decay integral at every band boundary is built once by the model;
+ *      a spacecraft only integrates the partial band it starts in, and B
+ *      scales the result instead of entering the quadrature
+ *
+ * 2. NEWTON ON A MONOTONE FUNCTION
+ *    - The integral is increasing and convex inside a band, so Newton's
+ *      method started at the upper end converges without bracketing
+ *
+ * 3. STRUCTURE OF ARRAYS
+ *    - The fleet is two input columns and three output columns, split into
+ *      chunks on the shared scheduler
+ *
+ * See also:
+ *   orbit.cpp for Orbit::LEO() and Orbit::ISS()
+ */
+
+#include "hohmann/drag.hpp"
+#include "hohmann/scheduler.hpp"
+
+#include <algorithm>    // std::upper_bound, std::min, std::max
+#include <array>        // std::array
+#include <cmath>        // std::exp, std::sqrt, std::ceil, std::abs
+#include <iterator>     // std::size
+#include <stdexcept>    // std::invalid_argument
+#include <string>       // std::to_string
+#include <utility>      // std::move
+
+namespace hohmann {
+
+namespace {
+
+// 8-point Gauss-Legendre nodes and weights on [-1, 1] (symmetric half)
+constexpr std::array<double, 4> gaussNodes = {0.1834346424956498, 0.5255324099163290,
+                                              0.7966664774136267, 0.9602898564975363};
+constexpr std::array<double, 4> gaussWeights = {0.3626837833783620, 0.3137066458778873,
+                                                0.2223810344533745, 0.1012285362903763};
+
+} // namespace
+
+// =============================================================================
+// ExponentialAtmosphere
+// =============================================================================
+
+ExponentialAtmosphere::ExponentialAtmosphere(std::vector<AtmosphereLayer> layers)
+    : m_layers(std::move(layers)) {
+    if (m_layers.empty()) {
+        throw std::invalid_argument("Atmosphere needs at least one layer");
+    }
+    for (std::size_t k = 0; k < m_layers.size(); ++k) {
+        const AtmosphereLayer& layer = m_layers[k];
+        if (!(layer.baseDensity > 0.0) || !(layer.scaleHeight > 0.0)) {
+            throw std::invalid_argument("Atmosphere layer " + std::to_string(k) +
+                                        " needs positive density and scale height");
+        }
+        if (k > 0 && !(layer.baseAltitude > m_layers[k - 1].baseAltitude)) {
+            throw std::invalid_argument("Atmosphere layers must be in increasing altitude order");
+        }
+    }
+}
+
+ExponentialAtmosphere ExponentialAtmosphere::Standard(double densityScale) {
+    // Vallado, Fundamentals of Astrodynamics and Applications, Table 8-4
+    //   base altitude [km], base density [kg/m³], scale height [km]
+    static constexpr double table[][3] = {
+        {0.0, 1.225, 7.249},          {25.0, 3.899e-2, 6.349},     {30.0, 1.774e-2, 6.682},
+        {40.0, 3.972e-3, 7.554},      {50.0, 1.057e-3, 8.382},     {60.0, 3.206e-4, 7.714},
+        {70.0, 8.770e-5, 6.549},      {80.0, 1.905e-5, 5.799},     {90.0, 3.396e-6, 5.382},
+        {100.0, 5.297e-7, 5.877},     {110.0, 9.661e-8, 7.263},    {120.0, 2.438e-8, 9.473},
+        {130.0, 8.484e-9, 12.636},    {140.0, 3.845e-9, 16.149},   {150.0, 2.070e-9, 22.523},
+        {180.0, 5.464e-10, 29.740},   {200.0, 2.789e-10, 37.105},  {250.0, 7.248e-11, 45.546},
+        {300.0, 2.418e-11, 53.628},   {350.0, 9.518e-12, 53.298},  {400.0, 3.725e-12, 58.515},
+        {450.0, 1.585e-12, 60.828},   {500.0, 6.967e-13, 63.822},  {600.0, 1.454e-13, 71.835},
+        {700.0, 3.614e-14, 88.667},   {800.0, 1.170e-14, 124.64},  {900.0, 5.245e-15, 181.05},
+        {1000.0, 3.019e-15, 268.00},
+    };
+    std::vector<AtmosphereLayer> layers;
+    layers.reserve(std::size(table));
+    for (const auto& row : table) {
+        layers.push_back({row[0] * 1e3, row[1] * densityScale, row[2] * 1e3});
+    }
+    return ExponentialAtmosphere(std::move(layers));
+}
+
+std::size_t ExponentialAtmosphere::layerIndex(double altitude) const {
+    auto above = std::upper_bound(m_layers.begin(), m_layers.end(), altitude,
+                                  [](double h, const AtmosphereLayer& layer) { return h < layer.baseAltitude; });
+    return above == m_layers.begin() ? 0 : static_cast<std::size_t>(above - m_layers.begin()) - 1;
+}
+
+double ExponentialAtmosphere::density(double altitude) const {
+    const AtmosphereLayer& layer = m_layers[layerIndex(altitude)];
+    return layer.baseDensity * std::exp(-(altitude - layer.baseAltitude) / layer.scaleHeight);
+}
+
+// =============================================================================
+// DragDecayModel
+// =============================================================================
+
+DragDecayModel::DragDecayModel(const CelestialBody& body, ExponentialAtmosphere atmosphere,
+                               double reentryAltitude)
+    : m_atmosphere(std::move(atmosphere)), m_mu(body.gm()), m_radius(0.0),
+      m_reentryAltitude(reentryAltitude) {
+    if (!body.radius()) {
+        throw std::invalid_argument("Drag decay needs a body with a defined radius");
+    }
+    if (!(reentryAltitude >= 0.0)) {
+        throw std::invalid_argument("Reentry altitude must not be negative");
+    }
+    m_radius = *body.radius();
+
+    // Tabulate the decay integral at the top of every band above reentry
+    const auto& layers = m_atmosphere.layers();
+    m_firstBand = m_atmosphere.layerIndex(reentryAltitude);
+    double lower = reentryAltitude, total = 0.0;
+    for (std::size_t k = m_firstBand; k + 1 < layers.size(); ++k) {
+        const double top = layers[k + 1].baseAltitude;
+        total += bandIntegral(k, lower, top);
+        m_bandTop.push_back(top);
+        m_cumulative.push_back(total);
+        lower = top;
+    }
+}
+
+DragDecayModel DragDecayModel::Earth(double densityScale) {
+    return DragDecayModel(CelestialBody::Earth(), ExponentialAtmosphere::Standard(densityScale));
+}
+
+double DragDecayModel::bandIntegral(std::size_t k, double lo, double hi) const {
+    if (!(hi > lo)) {
+        return 0.0;
+    }
+    const AtmosphereLayer& layer = m_atmosphere.layers()[k];
+    auto integrand = [&](double h) {
+        const double rho = layer.baseDensity * std::exp(-(h - layer.baseAltitude) / layer.scaleHeight);
+        return 1.0 / (rho * std::sqrt(m_mu * (m_radius + h)));
+    };
+
+    // One Gauss-Legendre panel per scale height keeps the exponential well resolved
+    const auto panels = static_cast<std::size_t>(std::max(1.0, std::ceil((hi - lo) / layer.scaleHeight)));
+    const double width = (hi - lo) / static_cast<double>(panels);
+    double sum = 0.0;
+    for (std::size_t p = 0; p < panels; ++p) {
+        const double mid = lo + (static_cast<double>(p) + 0.5) * width;
+        const double half = 0.5 * width;
+        for (std::size_t g = 0; g < gaussNodes.size(); ++g) {
+            sum += gaussWeights[g] * half *
+                   (integrand(mid - half * gaussNodes[g]) + integrand(mid + half * gaussNodes[g]));
+        }
+    }
+    return sum;
+}
+
+double DragDecayModel::decayIntegral(double altitude) const {
+    if (!(altitude > m_reentryAltitude)) {
+        return 0.0;
+    }
+    const std::size_t i = m_atmosphere.layerIndex(altitude) - m_firstBand;
+    const double lower = i == 0 ? m_reentryAltitude : m_bandTop[i - 1];
+    const double below = i == 0 ? 0.0 : m_cumulative[i - 1];
+    return below + bandIntegral(m_firstBand + i, lower, altitude);
+}
+
+double DragDecayModel::decayRate(double altitude, double ballisticCoefficient) const {
+    return -m_atmosphere.density(altitude) * std::sqrt(m_mu * (m_radius + altitude)) / ballisticCoefficient;
+}
+
+double DragDecayModel::lifetime(double altitude, double ballisticCoefficient) const {
+    if (!(ballisticCoefficient > 0.0)) {
+        throw std::invalid_argument("Ballistic coefficient must be positive");
+    }
+    return ballisticCoefficient * decayIntegral(altitude);
+}
+
+double DragDecayModel::lifetime(const Orbit& orbit, double ballisticCoefficient) const {
+    return lifetime(orbit.radius() - m_radius, ballisticCoefficient);
+}
+
+std::optional<double> DragDecayModel::altitudeAfter(double altitude, double ballisticCoefficient,
+                                                    double time) const {
+    if (!(ballisticCoefficient > 0.0)) {
+        throw std::invalid_argument("Ballistic coefficient must be positive");
+    }
+    if (!(time >= 0.0)) {
+        throw std::invalid_argument("Decay time must not be negative");
+    }
+    if (time == 0.0) {
+        return altitude;
+    }
+    const double target = decayIntegral(altitude) - time / ballisticCoefficient;
+    if (!(target > 0.0)) {
+        return std::nullopt;
+    }
+
+    // Band where the integral reaches the target, then Newton inside it
+    const auto i = static_cast<std::size_t>(
+        std::upper_bound(m_cumulative.begin(), m_cumulative.end(), target) - m_cumulative.begin());
+    const std::size_t k = m_firstBand + i;
+    const double lower = i == 0 ? m_reentryAltitude : m_bandTop[i - 1];
+    const double below = i == 0 ? 0.0 : m_cumulative[i - 1];
+    const double upper = i < m_bandTop.size() ? std::min(m_bandTop[i], altitude) : altitude;
+
+    double h = upper;
+    for (int iter = 0; iter < 50; ++iter) {
+        const double excess = below + bandIntegral(k, lower, h) - target;
+        const double slope = 1.0 / (m_atmosphere.density(h) * std::sqrt(m_mu * (m_radius + h)));
+        const double step = excess / slope;
+        h = std::max(lower, h - step);
+        if (std::abs(step) < 1e-3) {
+            break;
+        }
+    }
+    return h;
+}
+
+double DragDecayModel::reboostDeltaV(double altitude, double ballisticCoefficient, double duration) const {
+    if (!(ballisticCoefficient > 0.0)) {
+        throw std::invalid_argument("Ballistic coefficient must be positive");
+    }
+    const double v2 = m_mu / (m_radius + altitude);
+    return 0.5 * m_atmosphere.density(altitude) * v2 / ballisticCoefficient * duration;
+}
+
+// =============================================================================
+// Fleet batch
+// =============================================================================
+
+void DragColumns::resize(std::size_t count) {
+    altitude.resize(count);
+    ballisticCoefficient.resize(count);
+}
+
+void DecayColumns::resize(std::size_t count) {
+    lifetime.resize(count);
+    finalAltitude.resize(count);
+    reboostDeltaV.resize(count);
+}
+
+void estimateDecayBatch(const DragDecayModel& model, const DragColumns& fleet, DecayColumns& out,
+                        double horizon, const CancellationToken* token) {
+    if (!(horizon >= 0.0)) {
+        throw std::invalid_argument("Decay horizon must not be negative");
+    }
+    const std::size_t count = fleet.size();
+    for (std::size_t k = 0; k < count; ++k) {
+        if (!(fleet.ballisticCoefficient[k] > 0.0)) {
+            throw std::invalid_argument("Ballistic coefficient must be positive (spacecraft " +
+                                        std::to_string(k) + ")");
+        }
+    }
+
+    out.resize(count);
+    TaskScheduler::global().parallelFor(0, count, batchGrain, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t k = lo; k < hi; ++k) {
+            const double h = fleet.altitude[k];
+            const double b = fleet.ballisticCoefficient[k];
+            const double life = model.lifetime(h, b);
+            out.lifetime[k] = life;
+            out.finalAltitude[k] = model.reentryAltitude();
+            if (life > horizon) {
+                out.finalAltitude[k] = model.altitudeAfter(h, b, horizon).value_or(model.reentryAltitude());
+            }
+            out.reboostDeltaV[k] = model.reboostDeltaV(h, b, horizon);
+        }
+    }, token);
+}
+
+} // namespace hohmann
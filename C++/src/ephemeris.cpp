@@ -0,0 +1,91 @@
+/*
+ * ephemeris.cpp - Circular-coplanar planetary ephemeris
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Ephemerides
+ * ==============================================================================
+ *
+ * An ephemeris answers "where is the planet at time t?". Flight projects use
+ * JPL's DE440 (Chebyshev fits to numerically integrated orbits, accurate to
+ * kilometers). For preliminary searches a much cruder model is enough:
+ *
+ *   - Circular orbit at the mean heliocentric distance (orbitalRadius::)
+ *   - All planets in the ecliptic plane
+ *   - Constant angular rate n = sqrt(GM_sun / r^3)
+ *   - Phased by the mean longitude L0 at J2000.0:
+ *
+ *        L(t) = L0 + n * t
+ *        r(t) = R (cos L, sin L, 0)
+ *        v(t) = R n (-sin L, cos L, 0)
+ *
+ * This reproduces real launch-window timing (e.g. the 2020 Mars window) to
+ * within a few weeks, which is what a grid search over dates needs.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. PRECOMPUTING IN THE CONSTRUCTOR
+ *    - m_meanMotion is computed once, not on every position() call
+ *
+ * 2. STATIC FACTORY METHODS (same pattern as CelestialBody::Earth())
+ *
+ * See also:
+ *   constants.hpp for orbitalRadius:: and meanLongitudeJ2000::
+ */
+
+#include "hohmann/ephemeris.hpp"
+#include "hohmann/constants.hpp"
+
+#include <cmath>    // std::sin, std::cos, std::sqrt
+
+namespace hohmann {
+
+PlanetEphemeris::PlanetEphemeris(const CelestialBody& body, double orbitRadius,
+                                 double meanLongitudeAtJ2000, double surfaceRadius)
+    : m_body(body),
+      m_orbitRadius(orbitRadius),
+      m_longitude0(meanLongitudeAtJ2000),
+      m_surfaceRadius(surfaceRadius),
+      m_meanMotion(std::sqrt(gm::sun / (orbitRadius * orbitRadius * orbitRadius))) {}
+
+Vec3 PlanetEphemeris::position(double epoch) const {
+    double L = m_longitude0 + m_meanMotion * epoch;
+    return {m_orbitRadius * std::cos(L), m_orbitRadius * std::sin(L), 0.0};
+}
+
+Vec3 PlanetEphemeris::velocity(double epoch) const {
+    double L = m_longitude0 + m_meanMotion * epoch;
+    double speed = m_orbitRadius * m_meanMotion;
+    return {-speed * std::sin(L), speed * std::cos(L), 0.0};
+}
+
+// =============================================================================
+// PRE-DEFINED PLANETS
+// =============================================================================
+
+PlanetEphemeris PlanetEphemeris::Venus() {
+    return PlanetEphemeris(CelestialBody::Venus(), orbitalRadius::venus,
+                           meanLongitudeJ2000::venus * math::degToRad, bodyRadius::venus);
+}
+
+PlanetEphemeris PlanetEphemeris::Earth() {
+    return PlanetEphemeris(CelestialBody::Earth(), orbitalRadius::earth,
+                           meanLongitudeJ2000::earth * math::degToRad, bodyRadius::earth);
+}
+
+PlanetEphemeris PlanetEphemeris::Mars() {
+    return PlanetEphemeris(CelestialBody::Mars(), orbitalRadius::mars,
+                           meanLongitudeJ2000::mars * math::degToRad, bodyRadius::mars);
+}
+
+/**
+ * Jupiter's CelestialBody has no radius (gas giant), so the 1 bar level from
+ * bodyRadius::jupiter bounds how deep a flyby may go.
+ */
+PlanetEphemeris PlanetEphemeris::Jupiter() {
+    return PlanetEphemeris(CelestialBody::Jupiter(), orbitalRadius::jupiter,
+                           meanLongitudeJ2000::jupiter * math::degToRad, bodyRadius::jupiter);
+}
+
+} // namespace hohmann
@@ -0,0 +1,411 @@
+/*
+ * gravity_assist.cpp - Powered flybys and parallel MGA branch-and-bound search
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Gravity Assists
+ * ==============================================================================
+ *
+ * In the planet's frame a flyby is elastic: the spacecraft leaves with the
+ * same speed it arrived with, only its DIRECTION changes. But the planet is
+ * moving around the Sun, so in the Sun's frame the spacecraft can gain (or
+ * lose) kilometers per second for free:
+ *
+ *        v_out(helio) = v_planet + v_inf,out
+ *        v_in(helio)  = v_planet + v_inf,in        |v_inf,out| = |v_inf,in|
+ *
+ * How far the path bends depends on how close the spacecraft passes:
+ *
+ *        e = 1 + r_p v_inf^2 / mu          (hyperbola eccentricity)
+ *        half-turn = asin(1 / e)           (each side of periapsis)
+ *
+ * POWERED FLYBY:
+ *   When the trajectory needs a different outgoing speed, a burn at periapsis
+ *   joins two hyperbolas with different v_inf. The periapsis radius is solved
+ *   so asin(1/e_in) + asin(1/e_out) equals the required bend. If that radius
+ *   is below the planet's surface (plus a safety altitude), the flyby is
+ *   impossible.
+ *
+ * MULTIPLE GRAVITY ASSIST (MGA):
+ *   Galileo flew Venus-Earth-Earth to reach Jupiter (VEEGA) because direct
+ *   launch was too expensive. An MGA trajectory is a chain of Lambert arcs:
+ *
+ *     Earth --Lambert--> Venus --Lambert--> Earth --Lambert--> Jupiter
+ *      |                   |                  |                   |
+ *   departure burn     powered flyby      powered flyby       arrival
+ *
+ * BRANCH AND BOUND:
+ *   The decision variables are the launch date and every leg's time of
+ *   flight. A grid of those is a tree: pick a date, then leg 1's duration,
+ *   then leg 2's... Every cost term is >= 0, so the delta-v accumulated on a
+ *   partial branch is a LOWER BOUND on any completion. Once one complete
+ *   trajectory is known (the "incumbent"), any partial branch already more
+ *   expensive can be cut without exploring its subtree.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. TASK PARALLELISM ON THE SHARED SCHEDULER
+ *    - Every (sequence, date) root and every depth-1 subtree is a task in a
+ *      TaskGroup; the work-stealing scheduler (scheduler.hpp) keeps all
+ *      cores busy even though pruning makes subtree sizes wildly uneven
+ *
+ * 2. std::atomic FOR THE SHARED INCUMBENT
+ *    - Workers read the best cost constantly and write it rarely, so it is a
+ *      lock-free atomic updated with compare_exchange_weak; only recording
+ *      the full solution takes a mutex
+ *
+ * See also:
+ *   lambert.hpp for the arc solver
+ *   ephemeris.hpp for planet positions
+ *   patched_conic.hpp for departure/capture burns
+ *   scheduler.hpp for the task pool
+ */
+
+#include "hohmann/gravity_assist.hpp"
+#include "hohmann/hohmann_transfer.hpp"
+#include "hohmann/lambert.hpp"
+#include "hohmann/scheduler.hpp"
+
+#include <algorithm>    // std::max
+#include <atomic>       // std::atomic
+#include <cmath>        // std::asin, std::sqrt
+#include <limits>       // std::numeric_limits
+#include <memory>       // std::unique_ptr
+#include <mutex>        // std::mutex, std::lock_guard
+#include <stdexcept>    // std::invalid_argument
+
+namespace hohmann {
+
+namespace {
+
+constexpr double infinity = std::numeric_limits<double>::infinity();
+
+// =============================================================================
+// SEARCH STATE
+// =============================================================================
+
+/* One candidate sequence with its time-of-flight grids resolved */
+struct SequencePlan {
+    const std::vector<PlanetEphemeris>* bodies;
+    std::vector<std::vector<double>> tofGrid;  // One grid per leg [s]
+    std::vector<double> minPeriapsis;          // Per body [m]
+};
+
+/* The path from the root to the current node */
+struct PartialPath {
+    double departureEpoch = 0.0;
+    std::vector<double> tof;       // Per leg [s]
+    std::vector<double> legCost;   // Departure burn, then one per flyby [m/s]
+};
+
+/* Shared between every worker for one solve() call */
+struct SearchShared {
+    const MgaOptions& options;
+    TaskGroup& tasks;
+    std::atomic<double> incumbent{infinity};
+    std::atomic<std::size_t> lambertSolves{0};
+    std::atomic<std::size_t> pruned{0};
+    std::mutex bestMutex;
+    std::optional<MgaSolution> best;
+
+    SearchShared(const MgaOptions& o, TaskGroup& t) : options(o), tasks(t) {}
+};
+
+std::vector<double> linearGrid(double lo, double hi, std::size_t steps) {
+    std::vector<double> grid(steps);
+    for (std::size_t k = 0; k < steps; ++k) {
+        grid[k] = steps == 1 ? lo : lo + (hi - lo) * static_cast<double>(k) / (steps - 1);
+    }
+    return grid;
+}
+
+/**
+ * Automatic time-of-flight window for one leg.
+ *
+ * Different planets: 0.6-1.6 x the Hohmann time between their orbits.
+ * Same planet (resonant return, e.g. Earth-Earth): 0.9-2.1 x its period.
+ */
+TimeOfFlightRange automaticRange(const PlanetEphemeris& from, const PlanetEphemeris& to,
+                                 std::size_t steps) {
+    auto sun = CelestialBody::Sun();
+    if (std::abs(from.orbitRadius() - to.orbitRadius()) < 1.0) {
+        double period = Orbit(sun, from.orbitRadius()).period();
+        return {0.9 * period, 2.1 * period, steps};
+    }
+    HohmannTransfer hohmann(Orbit(sun, from.orbitRadius()), Orbit(sun, to.orbitRadius()));
+    double t_h = hohmann.result().transferTime;
+    return {0.6 * t_h, 1.6 * t_h, steps};
+}
+
+/**
+ * Offer a complete trajectory as the new incumbent.
+ */
+void recordSolution(SearchShared& shared, const SequencePlan& plan,
+                    const PartialPath& path, double arrivalCost, double total) {
+    double current = shared.incumbent.load(std::memory_order_relaxed);
+    while (total < current &&
+           !shared.incumbent.compare_exchange_weak(current, total, std::memory_order_relaxed)) {
+    }
+    if (total >= current) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(shared.bestMutex);
+    if (shared.best && shared.best->totalDeltaV <= total) {
+        return;
+    }
+    MgaSolution solution;
+    for (const auto& body : *plan.bodies) {
+        solution.sequence.push_back(body.body().name());
+    }
+    solution.departureEpoch = path.departureEpoch;
+    solution.legTimeOfFlight = path.tof;
+    solution.departureDeltaV = path.legCost[0];
+    solution.flybyDeltaV.assign(path.legCost.begin() + 1, path.legCost.end());
+    solution.arrivalDeltaV = arrivalCost;
+    solution.totalDeltaV = total;
+    shared.best = std::move(solution);
+}
+
+/**
+ * Depth-first expansion of one branch.
+ *
+ * Parameters:
+ *   leg - Index of the leg to fly next (body `leg` -> body `leg + 1`)
+ *   epoch - Time at body `leg` [s past J2000]
+ *   vInfIn - Arrival excess velocity at body `leg` (unused for leg 0)
+ *   cost - Delta-v accumulated so far [m/s]
+ *   spawnChildren - Push surviving subtrees as tasks instead of recursing
+ */
+void expand(SearchShared& shared, const SequencePlan& plan, PartialPath path,
+            std::size_t leg, double epoch, Vec3 vInfIn, double cost, bool spawnChildren) {
+    const auto& bodies = *plan.bodies;
+    const std::size_t legs = bodies.size() - 1;
+    const PlanetEphemeris& from = bodies[leg];
+    const PlanetEphemeris& to = bodies[leg + 1];
+
+    // Departure state is the same for every candidate duration
+    Vec3 r1 = from.position(epoch);
+    Vec3 v_from = from.velocity(epoch);
+
+    for (double tof : plan.tofGrid[leg]) {
+        double arrival_epoch = epoch + tof;
+        auto arc = solveLambert(r1, to.position(arrival_epoch), tof, gm::sun);
+        shared.lambertSolves.fetch_add(1, std::memory_order_relaxed);
+        if (!arc) {
+            continue;
+        }
+
+        Vec3 v_inf_out = arc->departureVelocity - v_from;
+        double leg_cost = leg == 0
+            ? hyperbolicPeriapsisDeltaV(norm(v_inf_out), from.body().gm(),
+                                        shared.options.parkingRadius, 0.0)
+            : poweredFlybyDeltaV(vInfIn, v_inf_out, from.body().gm(), plan.minPeriapsis[leg]);
+
+        // BOUND: partial cost already no better than the incumbent
+        double new_cost = cost + leg_cost;
+        if (new_cost >= shared.incumbent.load(std::memory_order_relaxed)) {
+            shared.pruned.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        Vec3 v_inf_arrival = arc->arrivalVelocity - to.velocity(arrival_epoch);
+        path.tof[leg] = tof;
+        path.legCost[leg] = leg_cost;
+
+        if (leg + 1 == legs) {
+            double v_inf = norm(v_inf_arrival);
+            double arrival_cost = shared.options.capture
+                ? hyperbolicPeriapsisDeltaV(v_inf, to.body().gm(),
+                                            shared.options.capture->periapsisRadius,
+                                            shared.options.capture->eccentricity)
+                : v_inf;
+            recordSolution(shared, plan, path, arrival_cost, new_cost + arrival_cost);
+        } else if (spawnChildren) {
+            // BRANCH: hand the subtree to the scheduler so idle workers can steal it
+            shared.tasks.spawn([&shared, &plan, path, leg, arrival_epoch, v_inf_arrival, new_cost] {
+                expand(shared, plan, path, leg + 1, arrival_epoch, v_inf_arrival, new_cost, false);
+            });
+        } else {
+            expand(shared, plan, path, leg + 1, arrival_epoch, v_inf_arrival, new_cost, false);
+        }
+    }
+}
+
+} // namespace
+
+// =============================================================================
+// POWERED FLYBY
+// =============================================================================
+
+/**
+ * Solve for the flyby periapsis radius, then price the periapsis burn.
+ *
+ * The achievable bend angle falls monotonically as periapsis rises, so a
+ * bisection on log(r_p) between the minimum radius and a radius where the
+ * bend is negligible always converges.
+ */
+double poweredFlybyDeltaV(const Vec3& vInfIn, const Vec3& vInfOut,
+                          double mu, double minimumPeriapsis) {
+    if (!(mu > 0.0 && minimumPeriapsis > 0.0)) {
+        throw std::invalid_argument("Powered flyby needs positive mu and minimum periapsis");
+    }
+    double v_in = norm(vInfIn);
+    double v_out = norm(vInfOut);
+    auto periapsisBurn = [&](double rp) {
+        return std::abs(std::sqrt(v_out * v_out + 2.0 * mu / rp)
+                      - std::sqrt(v_in * v_in + 2.0 * mu / rp));
+    };
+
+    // No incoming or outgoing direction (e.g. a resonant leg that returns
+    // to the planet on its own orbit): nothing to bend
+    if (v_in == 0.0 || v_out == 0.0) {
+        return periapsisBurn(minimumPeriapsis);
+    }
+
+    double cos_turn = dot(vInfIn, vInfOut) / (v_in * v_out);
+    double turn = std::acos(std::fmax(-1.0, std::fmin(1.0, cos_turn)));
+
+    auto bend = [&](double rp) {
+        double e_in = 1.0 + rp * v_in * v_in / mu;
+        double e_out = 1.0 + rp * v_out * v_out / mu;
+        return std::asin(1.0 / e_in) + std::asin(1.0 / e_out);
+    };
+
+    if (bend(minimumPeriapsis) < turn) {
+        return infinity;  // Would have to pass below the surface
+    }
+
+    double lo = std::log(minimumPeriapsis);
+    double hi = std::log(minimumPeriapsis * 1e6);
+    for (int iter = 0; iter < 60; ++iter) {
+        double mid = 0.5 * (lo + hi);
+        if (bend(std::exp(mid)) > turn) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return periapsisBurn(std::exp(0.5 * (lo + hi)));
+}
+
+// =============================================================================
+// MGA SEARCH
+// =============================================================================
+
+double MgaSolution::totalTimeOfFlight() const {
+    double total = 0.0;
+    for (double t : legTimeOfFlight) {
+        total += t;
+    }
+    return total;
+}
+
+MgaSearch::MgaSearch(MgaOptions options) : m_options(std::move(options)) {
+    if (m_options.departureSteps == 0 || m_options.departureWindowEnd < m_options.departureWindowStart) {
+        throw std::invalid_argument("MGA departure window must be non-empty");
+    }
+    if (!(m_options.parkingRadius > 0.0)) {
+        throw std::invalid_argument("MGA parking orbit radius must be positive");
+    }
+}
+
+std::optional<MgaSolution> MgaSearch::solve(
+        const std::vector<std::vector<PlanetEphemeris>>& sequences) {
+    // -------------------------------------------------------------------------
+    // Resolve time-of-flight grids and flyby limits per sequence
+    // -------------------------------------------------------------------------
+    std::vector<SequencePlan> plans;
+    plans.reserve(sequences.size());
+    for (const auto& bodies : sequences) {
+        if (bodies.size() < 2) {
+            throw std::invalid_argument("MGA sequence needs at least two bodies");
+        }
+        const std::size_t legs = bodies.size() - 1;
+        if (!m_options.legTimeOfFlight.empty() && m_options.legTimeOfFlight.size() != legs) {
+            throw std::invalid_argument(
+                "MGA legTimeOfFlight must have one range per leg of every sequence");
+        }
+
+        SequencePlan plan{&bodies, {}, {}};
+        for (std::size_t leg = 0; leg < legs; ++leg) {
+            TimeOfFlightRange range = m_options.legTimeOfFlight.empty()
+                ? automaticRange(bodies[leg], bodies[leg + 1], m_options.timeOfFlightSteps)
+                : m_options.legTimeOfFlight[leg];
+            plan.tofGrid.push_back(linearGrid(range.minimum, range.maximum,
+                                              std::max<std::size_t>(range.steps, 1)));
+        }
+        for (const auto& body : bodies) {
+            plan.minPeriapsis.push_back(body.surfaceRadius() + m_options.minimumFlybyAltitude);
+        }
+        plans.push_back(std::move(plan));
+    }
+
+    // -------------------------------------------------------------------------
+    // One root task per (sequence, departure date)
+    // -------------------------------------------------------------------------
+    // A private scheduler only when a specific thread count was asked for
+    std::unique_ptr<TaskScheduler> ownScheduler;
+    if (m_options.threadCount != 0) {
+        ownScheduler = std::make_unique<TaskScheduler>(SchedulerOptions{m_options.threadCount, false});
+    }
+    TaskScheduler& scheduler = ownScheduler ? *ownScheduler : TaskScheduler::global();
+    TaskGroup tasks(scheduler);
+    SearchShared shared(m_options, tasks);
+
+    auto dates = linearGrid(m_options.departureWindowStart, m_options.departureWindowEnd,
+                            m_options.departureSteps);
+    for (const auto& plan : plans) {
+        const std::size_t legs = plan.bodies->size() - 1;
+        for (double t0 : dates) {
+            tasks.spawn([&shared, &plan, legs, t0] {
+                PartialPath path;
+                path.departureEpoch = t0;
+                path.tof.assign(legs, 0.0);
+                path.legCost.assign(legs, 0.0);
+                expand(shared, plan, std::move(path), 0, t0, Vec3{}, 0.0, true);
+            });
+        }
+    }
+    tasks.wait();
+
+    m_stats.lambertSolves = shared.lambertSolves.load();
+    m_stats.branchesPruned = shared.pruned.load();
+    return shared.best;
+}
+
+// =============================================================================
+// SEQUENCE ENUMERATION
+// =============================================================================
+
+std::vector<std::vector<PlanetEphemeris>> enumerateSequences(
+        const PlanetEphemeris& departure, const PlanetEphemeris& arrival,
+        const std::vector<PlanetEphemeris>& flybyBodies, std::size_t maxFlybys) {
+    std::vector<std::vector<PlanetEphemeris>> result;
+    std::vector<std::vector<PlanetEphemeris>> chains = {{}};
+
+    for (std::size_t flybys = 0; flybys <= maxFlybys; ++flybys) {
+        for (const auto& chain : chains) {
+            std::vector<PlanetEphemeris> sequence{departure};
+            sequence.insert(sequence.end(), chain.begin(), chain.end());
+            sequence.push_back(arrival);
+            result.push_back(std::move(sequence));
+        }
+        if (flybys == maxFlybys || flybyBodies.empty()) {
+            break;
+        }
+        std::vector<std::vector<PlanetEphemeris>> longer;
+        for (const auto& chain : chains) {
+            for (const auto& body : flybyBodies) {
+                auto extended = chain;
+                extended.push_back(body);
+                longer.push_back(std::move(extended));
+            }
+        }
+        chains = std::move(longer);
+    }
+    return result;
+}
+
+} // namespace hohmann
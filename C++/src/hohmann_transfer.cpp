@@ -91,7 +91,8 @@
 
 #include "hohmann/hohmann_transfer.hpp"
 #include "hohmann/constants.hpp"
-#include <cmath>        // std::sqrt, std::pow, std::abs - mathematical functions
+#include "hohmann/transfer_kernel.hpp"
+#include <cmath>        // std::abs, std::pow, std::sqrt - mathematical functions
 #include <stdexcept>    // std::invalid_argument - exception type
 #include <iostream>     // std::cout - console output
 #include <iomanip>      // std::fixed, std::setprecision - output formatting
@@ -225,6 +226,17 @@ double HohmannTransfer::phaseAngle() const {
     return angle;  // in radians
 }
 
+/**
+ * Sensitivities of the transfer for gradient-based design loops.
+ *
+ * Runs the kernel calculate() uses, tangentTransfer(), once on dual
+ * numbers seeded with r1, r2 and mu (transferGradient() in
+ * transfer_kernel.hpp), so value and derivatives come from one code path.
+ */
+TransferGradient HohmannTransfer::gradient() const {
+    return transferGradient(m_initial.radius(), m_final.radius(), m_initial.body().gm());
+}
+
 // =============================================================================
 // CORE CALCULATION
 // =============================================================================
@@ -237,6 +249,9 @@ double HohmannTransfer::phaseAngle() const {
  *   2. Velocities at each point using the vis-viva equation
  *   3. Delta-v required for each burn
  *   4. Total transfer time
+ *
+ * The steps below explain the physics; the arithmetic itself is
+ * tangentTransfer() in transfer_kernel.hpp, evaluated here on double.
  */
 void HohmannTransfer::calculate() {
     // =========================================================================
@@ -263,7 +278,6 @@ void HohmannTransfer::calculate() {
     //
     // This is simply the AVERAGE of the two orbital radii.
     // =========================================================================
-    double a_transfer = (r1 + r2) / 2.0;
 
     // =========================================================================
     // STEP 3: Calculate velocities using the vis-viva equation
@@ -298,20 +312,6 @@ void HohmannTransfer::calculate() {
     // For compile-time constants, you could use constexpr functions instead.
     // =========================================================================
 
-    // Velocity in initial circular orbit
-    // For circular: v = sqrt(mu/r)  [vis-viva with r = a]
-    double v1 = std::sqrt(mu / r1);
-
-    // Velocity at periapsis of transfer orbit (at radius r1)
-    // Uses full vis-viva: v^2 = mu * (2/r1 - 1/a_transfer)
-    double v_transfer_periapsis = std::sqrt(mu * (2.0/r1 - 1.0/a_transfer));
-
-    // Velocity at apoapsis of transfer orbit (at radius r2)
-    double v_transfer_apoapsis = std::sqrt(mu * (2.0/r2 - 1.0/a_transfer));
-
-    // Velocity in final circular orbit
-    double v2 = std::sqrt(mu / r2);
-
     // =========================================================================
     // STEP 4: Calculate delta-v for each burn
     // =========================================================================
@@ -331,29 +331,6 @@ void HohmannTransfer::calculate() {
     //
     // We take absolute values because dv magnitude is what matters for fuel.
     // =========================================================================
-    double dv1, dv2;
-
-    if (r2 > r1) {
-        // RAISING ORBIT: Both burns speed us up (prograde)
-        // ------------------------------------------------
-        // Burn 1: At periapsis, speed up to enter transfer orbit
-        //         Current velocity: v1 (circular)
-        //         Needed velocity: v_transfer_periapsis (faster, to raise apoapsis)
-        dv1 = v_transfer_periapsis - v1;
-
-        // Burn 2: At apoapsis, speed up to circularize
-        //         Current velocity: v_transfer_apoapsis (slow at apoapsis)
-        //         Needed velocity: v2 (circular, faster than transfer apoapsis)
-        dv2 = v2 - v_transfer_apoapsis;
-    } else {
-        // LOWERING ORBIT: Both burns slow us down (retrograde)
-        // ----------------------------------------------------
-        // The math is reversed but the principle is the same.
-        // At higher orbit, we slow down to drop periapsis.
-        // At lower orbit, we slow down again to circularize.
-        dv1 = v1 - v_transfer_periapsis;
-        dv2 = v_transfer_apoapsis - v2;
-    }
 
     // =========================================================================
     // STEP 5: Calculate transfer time
@@ -374,16 +351,17 @@ void HohmannTransfer::calculate() {
     // This is why GEO satellite deployment takes several hours - you can't
     // rush orbital mechanics!
     // =========================================================================
-    double T_transfer = math::pi * std::sqrt(std::pow(a_transfer, 3) / mu);
 
     // =========================================================================
-    // STEP 6: Store results in the TransferResult struct
+    // STEP 6: Evaluate the kernel
+    // =========================================================================
+    // Steps 2-5 are carried out by tangentTransfer() in transfer_kernel.hpp,
+    // the same template the batch engines and gradient() use, so every path
+    // shares one implementation of the formulas above. A circular orbit is
+    // the special case where the burn radius equals the semi-major axis,
+    // and the kernel's abs() covers both raising and lowering transfers.
     // =========================================================================
-    m_result.deltaV1 = std::abs(dv1);          // Always positive magnitude
-    m_result.deltaV2 = std::abs(dv2);
-    m_result.totalDeltaV = m_result.deltaV1 + m_result.deltaV2;
-    m_result.transferTime = T_transfer;         // In seconds
-    m_result.semiMajorAxis = a_transfer;       // In meters
+    m_result = tangentTransfer(r1, r1, r2, r2, mu);
 }
 
 // =============================================================================
@@ -0,0 +1,119 @@
+/*
+ * hohmannd.cpp - Entry point for the hohmannd query daemon
+ *
+ * ==============================================================================
+ * USAGE
+ * ==============================================================================
+ *
+ *   $ hohmannd --tcp 7878 &
+ *   $ printf 'TRANSFER 6778137 42164137\nSTATS\n' | socat - UNIX-CONNECT:/tmp/hohmannd.sock
+ *   $ printf 'PING\n' | nc -q1 127.0.0.1 7878
+ *
+ * The protocol is described in query_server.hpp. Ctrl-C or SIGTERM stops
+ * the server, removes the socket file and prints the latency statistics.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. SIGNAL HANDLERS
+ *    - A handler may only call async-signal-safe functions, so it does not
+ *      touch the server's state; QueryServer::stop() just writes to an
+ *      eventfd, and the event loop notices on its next wakeup
+ *
+ * See also:
+ *   main.cpp for the one-shot command-line tool
+ *   query_server.cpp for the event loop
+ */
+
+#include "hohmann/query_server.hpp"
+#include "hohmann/scheduler.hpp"
+
+#include <csignal>      // std::signal, SIGINT, SIGTERM
+#include <iostream>     // std::cout, std::cerr
+#include <stdexcept>    // std::invalid_argument
+#include <string>       // std::string, std::stoi
+
+using namespace hohmann;
+
+namespace {
+
+QueryServer* g_server = nullptr;
+
+extern "C" void handleSignal(int) {
+    if (g_server) {
+        g_server->stop();
+    }
+}
+
+void printUsage() {
+    std::cout << "hohmannd - Hohmann transfer query daemon\n\n";
+    std::cout << "Usage: hohmannd [--socket PATH] [--no-socket] [--tcp PORT] [--threads N]\n\n";
+    std::cout << "Options:\n";
+    std::cout << "  --socket PATH   Unix-domain socket (default: /tmp/hohmannd.sock)\n";
+    std::cout << "  --no-socket     Do not listen on a Unix-domain socket\n";
+    std::cout << "  --tcp PORT      Also listen on 127.0.0.1:PORT (0 = any free port)\n";
+    std::cout << "  --threads N     Worker threads for batch and sweep kernels\n\n";
+    std::cout << "Requests (one per line):\n";
+    std::cout << "  PING | TRANSFER r1 r2 [mu] | SWEEP r1min r1max n1 r2min r2max n2 [k] [mu]\n";
+    std::cout << "  STATS | QUIT                 (radii in m, mu in m^3/s^2, default Earth)\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        QueryServerOptions options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--socket" && i + 1 < argc) {
+                options.socketPath = argv[++i];
+            } else if (arg == "--no-socket") {
+                options.socketPath.clear();
+            } else if (arg == "--tcp" && i + 1 < argc) {
+                options.tcpPort = std::stoi(argv[++i]);
+                if (options.tcpPort < 0 || options.tcpPort > 65535) {
+                    throw std::invalid_argument("--tcp port must be between 0 and 65535");
+                }
+            } else if (arg == "--threads" && i + 1 < argc) {
+                const int threads = std::stoi(argv[++i]);
+                if (threads < 1) {
+                    throw std::invalid_argument("--threads must be at least 1");
+                }
+                SchedulerOptions scheduler;
+                scheduler.workerCount = static_cast<std::size_t>(threads);
+                TaskScheduler::configureGlobal(scheduler);
+            } else if (arg == "--help") {
+                printUsage();
+                return 0;
+            } else {
+                printUsage();
+                return 1;
+            }
+        }
+
+        QueryServer server(options);
+        g_server = &server;
+        std::signal(SIGINT, handleSignal);
+        std::signal(SIGTERM, handleSignal);
+
+        std::cerr << "hohmannd listening on";
+        if (!options.socketPath.empty()) {
+            std::cerr << " unix:" << options.socketPath;
+        }
+        if (server.tcpPort() >= 0) {
+            std::cerr << " tcp:127.0.0.1:" << server.tcpPort();
+        }
+        std::cerr << std::endl;
+
+        server.run();
+
+        g_server = nullptr;
+        std::cout << server.statistics();
+        return 0;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+}
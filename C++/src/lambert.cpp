@@ -0,0 +1,193 @@
+/*
+ * lambert.cpp - Universal-variable solution of Lambert's problem
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Lambert's Problem
+ * ==============================================================================
+ *
+ * A Hohmann transfer assumes the planets will be exactly 180 degrees apart
+ * when we arrive. Real mission design asks a different question:
+ *
+ *   "I leave planet A at date t1 and want to reach planet B at date t2.
+ *    Which orbit connects the two positions in exactly that time?"
+ *
+ * That is Lambert's problem. Given r1, r2 and time of flight, it returns the
+ * velocities needed at both ends. Subtracting the planets' own velocities
+ * gives the hyperbolic excess speeds - the same v_inf that the patched-conic
+ * engine turns into departure and capture burns.
+ *
+ *                     r2 (arrival, time t2)
+ *                    *
+ *                  /   .
+ *                /       .   <- conic arc, duration t2 - t1
+ *         Sun  @           .
+ *                \          .
+ *                  \       .
+ *                    *  .
+ *                     r1 (departure, time t1)
+ *
+ * UNIVERSAL VARIABLE METHOD (Bate, Mueller & White; Curtis Algorithm 5.2):
+ *   One unknown z decides the conic type: z > 0 ellipse, z = 0 parabola,
+ *   z < 0 hyperbola. Time of flight is a monotonic function of z for the
+ *   zero-revolution case, so we solve F(z) = t(z) - t_target = 0 with a
+ *   Newton iteration that falls back to bisection whenever Newton would leave
+ *   the bracket. That keeps the solver robust for the very short and very
+ *   long transfers a search routine throws at it.
+ *
+ *   A    = sin(dtheta) * sqrt(r1 r2 / (1 - cos(dtheta)))
+ *   y(z) = r1 + r2 + A (z S(z) - 1) / sqrt(C(z))
+ *   t(z) = [ (y/C)^1.5 S + A sqrt(y) ] / sqrt(mu)
+ *
+ *   Lagrange coefficients then give the velocities:
+ *   f = 1 - y/r1,  g = A sqrt(y/mu),  gdot = 1 - y/r2
+ *   v1 = (r2 - f r1) / g,   v2 = (gdot r2 - r1) / g
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. std::optional FOR "NO ANSWER"
+ *    - A degenerate geometry is not a programming error, so we return
+ *      std::nullopt instead of throwing; search loops just skip the case
+ *
+ * 2. LAMBDAS CAPTURING LOCAL STATE
+ *    - `yOf` captures r1, r2 and A so the iteration reads like the math
+ *
+ * See also:
+ *   stumpff.hpp for C(z) and S(z)
+ *   gravity_assist.hpp for the multiple-flyby search that calls this solver
+ */
+
+#include "hohmann/lambert.hpp"
+#include "hohmann/constants.hpp"
+#include "hohmann/stumpff.hpp"
+
+#include <cmath>        // std::sqrt, std::acos, std::pow
+#include <stdexcept>    // std::invalid_argument
+
+namespace hohmann {
+
+std::optional<LambertSolution> solveLambert(const Vec3& r1, const Vec3& r2,
+                                            double timeOfFlight, double mu,
+                                            bool prograde) {
+    if (!(timeOfFlight > 0.0)) {
+        throw std::invalid_argument("Lambert time of flight must be positive");
+    }
+
+    double r1_mag = norm(r1);
+    double r2_mag = norm(r2);
+
+    // =========================================================================
+    // STEP 1: Transfer angle, picking short or long way from the direction
+    // of motion (sign of the z component of r1 x r2)
+    // =========================================================================
+    double cos_dtheta = dot(r1, r2) / (r1_mag * r2_mag);
+    cos_dtheta = std::fmax(-1.0, std::fmin(1.0, cos_dtheta));
+    double dtheta = std::acos(cos_dtheta);
+    double cross_z = cross(r1, r2).z;
+    if ((prograde && cross_z < 0.0) || (!prograde && cross_z >= 0.0)) {
+        dtheta = math::twoPi - dtheta;
+    }
+
+    // A = 0 at dtheta = 0 or pi: the transfer plane is undefined there
+    double one_minus_cos = 1.0 - cos_dtheta;
+    if (one_minus_cos < 1e-12) {
+        return std::nullopt;
+    }
+    double A = std::sin(dtheta) * std::sqrt(r1_mag * r2_mag / one_minus_cos);
+    if (std::abs(A) < 1e-9 * std::sqrt(r1_mag * r2_mag)) {
+        return std::nullopt;
+    }
+
+    auto yOf = [&](double z) {
+        return r1_mag + r2_mag + A * (z * stumpffS(z) - 1.0) / std::sqrt(stumpffC(z));
+    };
+
+    const double sqrt_mu_t = std::sqrt(mu) * timeOfFlight;
+
+    // F(z) = sqrt(mu) * (t(z) - t_target); only defined where y(z) >= 0
+    auto fOf = [&](double z, double y) {
+        double C = stumpffC(z);
+        double S = stumpffS(z);
+        return std::pow(y / C, 1.5) * S + A * std::sqrt(y) - sqrt_mu_t;
+    };
+
+    // dF/dz (Curtis eq. 5.43), with the z = 0 limit handled separately
+    auto dfOf = [&](double z, double y) {
+        double C = stumpffC(z);
+        double S = stumpffS(z);
+        if (std::abs(z) < 1e-8) {
+            return std::sqrt(2.0) / 40.0 * std::pow(y, 1.5)
+                 + A / 8.0 * (std::sqrt(y) + A * std::sqrt(1.0 / (2.0 * y)));
+        }
+        return std::pow(y / C, 1.5) * (1.0 / (2.0 * z) * (C - 1.5 * S / C) + 0.75 * S * S / C)
+             + A / 8.0 * (3.0 * S / C * std::sqrt(y) + A * std::sqrt(C / y));
+    };
+
+    // =========================================================================
+    // STEP 2: Bracket the root. Upper end: z -> 4 pi^2 sends t -> infinity.
+    // Lower end: push further into the hyperbolic region until t < target.
+    // =========================================================================
+    double z_hi = 4.0 * math::pi * math::pi - 1e-6;
+    double z_lo = -4.0 * math::pi * math::pi;
+    for (int k = 0; k < 60; ++k) {
+        double y = yOf(z_lo);
+        if (y < 0.0 || fOf(z_lo, y) < 0.0) {
+            break;
+        }
+        z_lo *= 2.0;
+    }
+
+    // =========================================================================
+    // STEP 3: Safeguarded Newton iteration on z
+    // =========================================================================
+    double z = 0.0;
+    bool converged = false;
+    for (int iter = 0; iter < 100; ++iter) {
+        double y = yOf(z);
+        if (y < 0.0) {
+            // Below the region where the arc exists: move up, bisect
+            z_lo = z;
+            z = 0.5 * (z_lo + z_hi);
+            continue;
+        }
+
+        double F = fOf(z, y);
+        if (std::abs(F) < 1e-10 * sqrt_mu_t) {
+            converged = true;
+            break;
+        }
+        if (F < 0.0) {
+            z_lo = z;
+        } else {
+            z_hi = z;
+        }
+
+        double dF = dfOf(z, y);
+        double z_newton = z - F / dF;
+        z = (dF > 0.0 && z_newton > z_lo && z_newton < z_hi) ? z_newton : 0.5 * (z_lo + z_hi);
+
+        if (z_hi - z_lo < 1e-14 * (1.0 + std::abs(z))) {
+            converged = true;
+            break;
+        }
+    }
+    if (!converged) {
+        return std::nullopt;
+    }
+
+    // =========================================================================
+    // STEP 4: Lagrange coefficients -> terminal velocities
+    // =========================================================================
+    double y = yOf(z);
+    double f = 1.0 - y / r1_mag;
+    double g = A * std::sqrt(y / mu);
+    double g_dot = 1.0 - y / r2_mag;
+
+    LambertSolution solution;
+    solution.departureVelocity = (r2 - f * r1) / g;
+    solution.arrivalVelocity = (g_dot * r2 - r1) / g;
+    return solution;
+}
+
+} // namespace hohmann
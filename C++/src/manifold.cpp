@@ -0,0 +1,366 @@
+/*
+ * manifold.cpp - Invariant manifolds of CR3BP periodic orbits
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Invariant Manifolds and Low-Energy Transfers
+ * ==============================================================================
+ *
+ * A halo or Lyapunov orbit about L1/L2 is unstable: a tiny nudge grows by a
+ * factor of hundreds each revolution. That instability is useful. The set
+ * of all trajectories that peel away from the orbit forms a tube - the
+ * UNSTABLE MANIFOLD - and the trajectories that wind onto it form the
+ * STABLE MANIFOLD:
+ *
+ *          stable tube            unstable tube
+ *      ==================>  ( O )  ==================>
+ *                          orbit
+ *
+ * Riding these tubes costs no propellant. Genesis, ARTEMIS and many lunar
+ * low-energy transfers were designed by finding where an unstable tube of
+ * one orbit meets a stable tube of another on a Poincaré section (a plane
+ * the trajectories pierce), then patching them with a small burn.
+ *
+ * The tubes are sampled numerically: compute the monodromy matrix M (the
+ * STM over one period), take its eigenvector for the eigenvalue lambda > 1
+ * (unstable) or 1 / lambda (stable), carry it around the orbit with the
+ * STM, displace a state slightly along it and integrate.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. EMBARRASSINGLY PARALLEL FAN-OUT
+ *    - Every trajectory is independent; each task keeps its crossings in
+ *      its own slot, so no locks are needed and the output order is fixed
+ *
+ * 2. COLUMNAR OUTPUT
+ *    - Crossings are concatenated into one column per field, which keeps
+ *      the intersection search streaming over contiguous doubles
+ *
+ * See also:
+ *   cr3bp.hpp for the periodic orbits and the variational integrator
+ */
+
+#include "hohmann/manifold.hpp"
+
+#include <algorithm>    // std::sort, std::lower_bound, std::swap
+#include <array>        // std::array
+#include <cmath>        // std::abs, std::sqrt
+#include <mutex>        // std::mutex, std::lock_guard
+#include <numeric>      // std::iota
+#include <stdexcept>    // std::invalid_argument, std::runtime_error
+
+namespace hohmann {
+
+namespace {
+
+using Matrix6 = std::array<double, 36>;
+
+Matrix6 stmOf(const Cr3bpVariational& y) {
+    Matrix6 m;
+    std::copy(y.begin() + 6, y.end(), m.begin());
+    return m;
+}
+
+Cr3bpState multiply(const Matrix6& m, const Cr3bpState& v) {
+    Cr3bpState r{};
+    for (int i = 0; i < 6; ++i) {
+        for (int j = 0; j < 6; ++j) {
+            r[i] += m[6 * i + j] * v[j];
+        }
+    }
+    return r;
+}
+
+/* Solve m x = b by Gaussian elimination with partial pivoting */
+bool solve(Matrix6 m, Cr3bpState b, Cr3bpState& x) {
+    for (int col = 0; col < 6; ++col) {
+        int pivot = col;
+        for (int row = col + 1; row < 6; ++row) {
+            if (std::abs(m[6 * row + col]) > std::abs(m[6 * pivot + col])) {
+                pivot = row;
+            }
+        }
+        if (m[6 * pivot + col] == 0.0) {
+            return false;
+        }
+        if (pivot != col) {
+            for (int j = 0; j < 6; ++j) {
+                std::swap(m[6 * col + j], m[6 * pivot + j]);
+            }
+            std::swap(b[col], b[pivot]);
+        }
+        for (int row = col + 1; row < 6; ++row) {
+            double factor = m[6 * row + col] / m[6 * col + col];
+            for (int j = col; j < 6; ++j) {
+                m[6 * row + j] -= factor * m[6 * col + j];
+            }
+            b[row] -= factor * b[col];
+        }
+    }
+    for (int row = 5; row >= 0; --row) {
+        double sum = b[row];
+        for (int j = row + 1; j < 6; ++j) {
+            sum -= m[6 * row + j] * x[j];
+        }
+        x[row] = sum / m[6 * row + row];
+    }
+    return true;
+}
+
+double length(const Cr3bpState& v) {
+    double sum = 0.0;
+    for (double c : v) {
+        sum += c * c;
+    }
+    return std::sqrt(sum);
+}
+
+/**
+ * Dominant real eigenvector of M (or of M^-1) by power iteration. The
+ * eigenvalues of a CR3BP monodromy matrix come in pairs (lambda, 1/lambda),
+ * so for an unstable orbit the dominant one is well separated.
+ */
+Cr3bpState dominantEigenvector(const Matrix6& m, bool inverse, double& eigenvalue) {
+    Cr3bpState v{1.0, 0.5, 0.25, 0.125, 0.0625, 0.03125};
+    eigenvalue = 0.0;
+    for (int iter = 0; iter < 1000; ++iter) {
+        Cr3bpState w{};
+        if (inverse) {
+            if (!solve(m, v, w)) {
+                break;
+            }
+        } else {
+            w = multiply(m, v);
+        }
+        double norm_w = length(w);
+        if (norm_w == 0.0) {
+            break;
+        }
+        // Allow the eigenvalue to be negative (orbit-reversing eigenvector)
+        double dot = 0.0;
+        for (int i = 0; i < 6; ++i) {
+            dot += w[i] * v[i];
+        }
+        double change = 0.0;
+        for (int i = 0; i < 6; ++i) {
+            double next = (dot < 0.0 ? -w[i] : w[i]) / norm_w;
+            change = std::max(change, std::abs(next - v[i]));
+            v[i] = next;
+        }
+        eigenvalue = norm_w;
+        if (change < 1e-13) {
+            break;
+        }
+    }
+    return v;
+}
+
+struct Crossing {
+    double time;
+    Cr3bpState state;
+};
+
+} // namespace
+
+void SectionCrossings::resize(std::size_t count) {
+    trajectory.resize(count);
+    crossing.resize(count);
+    time.resize(count);
+    x.resize(count);
+    y.resize(count);
+    z.resize(count);
+    vx.resize(count);
+    vy.resize(count);
+    vz.resize(count);
+}
+
+const std::vector<double>& SectionCrossings::column(std::size_t coordinate) const {
+    switch (coordinate) {
+        case 0: return x;
+        case 1: return y;
+        case 2: return z;
+        case 3: return vx;
+        case 4: return vy;
+        case 5: return vz;
+        default: break;
+    }
+    throw std::invalid_argument("Cr3bpState coordinate index must be 0..5");
+}
+
+SectionCrossings generateManifold(const Cr3bpSystem& system, const PeriodicOrbit& orbit,
+                                  ManifoldBranch branch, const PoincareSection& section,
+                                  ManifoldOptions options, const CancellationToken* token) {
+    if (options.seeds == 0) {
+        throw std::invalid_argument("Manifold needs at least one seed");
+    }
+    if (section.coordinate > 5) {
+        throw std::invalid_argument("Cr3bpState coordinate index must be 0..5");
+    }
+    const bool stable = branch == ManifoldBranch::Stable;
+
+    // -------------------------------------------------------------------------
+    // Monodromy matrix and the eigenvector of this branch
+    // -------------------------------------------------------------------------
+    auto full = system.propagateVariational(Cr3bpSystem::withIdentityStm(orbit.initialState),
+                                            orbit.period);
+    if (!full) {
+        throw std::runtime_error("Periodic orbit could not be integrated");
+    }
+    double eigenvalue = 0.0;
+    Cr3bpState v0 = dominantEigenvector(stmOf(*full), stable, eigenvalue);
+    if (!(eigenvalue > 1.0 + 1e-6)) {
+        throw std::invalid_argument("Periodic orbit is not unstable; it has no manifolds");
+    }
+    if (v0[0] < 0.0) {
+        for (double& c : v0) {
+            c = -c;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Seeds: step around the orbit, carrying the eigenvector with the STM
+    // -------------------------------------------------------------------------
+    const std::size_t seeds = options.seeds;
+    std::vector<Cr3bpState> starts(2 * seeds);
+    Cr3bpVariational along = Cr3bpSystem::withIdentityStm(orbit.initialState);
+    const double dt = orbit.period / static_cast<double>(seeds);
+    for (std::size_t k = 0; k < seeds; ++k) {
+        if (k > 0) {
+            auto next = system.propagateVariational(along, dt);
+            if (!next) {
+                throw std::runtime_error("Periodic orbit could not be integrated");
+            }
+            along = *next;
+        }
+        Cr3bpState v = multiply(stmOf(along), v0);
+        const double position_norm = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        const double scale = options.perturbation / position_norm;
+        for (int i = 0; i < 6; ++i) {
+            starts[2 * k][i] = along[i] + scale * v[i];
+            starts[2 * k + 1][i] = along[i] - scale * v[i];
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Fan-out: integrate every trajectory to its section crossings
+    // -------------------------------------------------------------------------
+    const double timeSign = stable ? -1.0 : 1.0;
+    auto rhs = [&system, timeSign](double, const Cr3bpState& s, Cr3bpState& d) {
+        system.derivative(s, d);
+        for (double& c : d) {
+            c *= timeSign;
+        }
+    };
+    const std::size_t coordinate = section.coordinate;
+    const double value = section.value;
+    auto event = [coordinate, value](double, const Cr3bpState& s) { return s[coordinate] - value; };
+    OdeOptions ode;
+    ode.relativeTolerance = options.tolerance;
+    ode.absoluteTolerance = options.tolerance;
+
+    std::vector<std::vector<Crossing>> found(starts.size());
+    TaskScheduler::global().parallelFor(0, starts.size(), 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t traj = first; traj < last; ++traj) {
+            if (token && token->cancelled()) {
+                break;
+            }
+            Cr3bpState y = starts[traj];
+            double t = 0.0;
+            OdeOptions stepping = ode;   // initialStep carries the last step across restarts
+            while (found[traj].size() < options.maxCrossings && t < options.maxTime) {
+                if (!integrateToEvent(rhs, t, y, options.maxTime, event, stepping, &stepping.initialStep)) {
+                    break;
+                }
+                Cr3bpState rate;
+                system.derivative(y, rate);
+                if (directionMatches(section.direction, rate[coordinate])) {
+                    found[traj].push_back({timeSign * t, y});
+                }
+            }
+        }
+    }, token);
+
+    // -------------------------------------------------------------------------
+    // Concatenate into columns, in trajectory order
+    // -------------------------------------------------------------------------
+    std::size_t total = 0;
+    for (const auto& list : found) {
+        total += list.size();
+    }
+    SectionCrossings out;
+    out.resize(total);
+    std::size_t row = 0;
+    for (std::size_t traj = 0; traj < found.size(); ++traj) {
+        for (std::size_t c = 0; c < found[traj].size(); ++c) {
+            const Crossing& cr = found[traj][c];
+            out.trajectory[row] = static_cast<std::uint32_t>(traj);
+            out.crossing[row] = static_cast<std::uint16_t>(c);
+            out.time[row] = cr.time;
+            out.x[row] = cr.state[0];
+            out.y[row] = cr.state[1];
+            out.z[row] = cr.state[2];
+            out.vx[row] = cr.state[3];
+            out.vy[row] = cr.state[4];
+            out.vz[row] = cr.state[5];
+            ++row;
+        }
+    }
+    return out;
+}
+
+std::vector<SectionMatch> matchSectionCrossings(const SectionCrossings& first,
+                                                const SectionCrossings& second,
+                                                const std::vector<std::size_t>& coordinates,
+                                                double tolerance) {
+    if (coordinates.empty()) {
+        throw std::invalid_argument("Section matching needs at least one coordinate");
+    }
+    std::vector<const std::vector<double>*> colsA, colsB;
+    for (std::size_t c : coordinates) {
+        colsA.push_back(&first.column(c));
+        colsB.push_back(&second.column(c));
+    }
+
+    // Sort the second buffer once on the leading coordinate
+    const std::vector<double>& keyB = *colsB[0];
+    std::vector<std::size_t> order(second.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::sort(order.begin(), order.end(), [&keyB](std::size_t a, std::size_t b) {
+        return keyB[a] < keyB[b] || (keyB[a] == keyB[b] && a < b);
+    });
+    std::vector<double> sortedKeys(order.size());
+    for (std::size_t k = 0; k < order.size(); ++k) {
+        sortedKeys[k] = keyB[order[k]];
+    }
+
+    std::vector<SectionMatch> matches;
+    std::mutex matchesMutex;
+    TaskScheduler::global().parallelFor(0, first.size(), 1024, [&](std::size_t lo, std::size_t hi) {
+        std::vector<SectionMatch> local;
+        for (std::size_t i = lo; i < hi; ++i) {
+            const double key = (*colsA[0])[i];
+            auto it = std::lower_bound(sortedKeys.begin(), sortedKeys.end(), key - tolerance);
+            for (std::size_t k = static_cast<std::size_t>(it - sortedKeys.begin());
+                 k < sortedKeys.size() && sortedKeys[k] <= key + tolerance; ++k) {
+                const std::size_t j = order[k];
+                double distance = 0.0;
+                for (std::size_t c = 0; c < colsA.size() && distance <= tolerance; ++c) {
+                    distance = std::max(distance, std::abs((*colsA[c])[i] - (*colsB[c])[j]));
+                }
+                if (distance <= tolerance) {
+                    local.push_back({i, j, distance});
+                }
+            }
+        }
+        std::lock_guard<std::mutex> lock(matchesMutex);
+        matches.insert(matches.end(), local.begin(), local.end());
+    });
+
+    std::sort(matches.begin(), matches.end(), [](const SectionMatch& a, const SectionMatch& b) {
+        return a.first < b.first || (a.first == b.first && a.second < b.second);
+    });
+    return matches;
+}
+
+} // namespace hohmann
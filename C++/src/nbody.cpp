@@ -0,0 +1,566 @@
+/*
+ * nbody.cpp - Barnes-Hut N-body integrator
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Many-Body Gravity
+ * ==============================================================================
+ *
+ * Everything else in this library is a two-body problem: one central body,
+ * one spacecraft. Over decades, though, an asteroid's orbit is shaped by
+ * Jupiter, a debris cloud spreads under lunar and solar tides, and the
+ * question "is this orbit stable?" can only be answered by integrating all
+ * the bodies together.
+ *
+ * Direct summation costs N² force evaluations per step. The Barnes-Hut
+ * method groups distant particles into octree cells and treats each far
+ * cell as one point mass at its centre of mass:
+ *
+ *     +-------+-------+
+ *     | . .   |       |        Seen from *, the whole right half is
+ *     |  .    |  ...  |        "far": size / distance < theta, so its
+ *     +---+---+  ..:  |        particles act as one mass. Near cells are
+ *     |*  |.  |       |        opened and their children examined.
+ *     +---+---+-------+
+ *
+ * That brings the cost down to N log N. The opening angle theta trades
+ * accuracy for speed: theta = 0 opens everything (exact), theta ~ 1 is
+ * fast but coarse.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. SPACE-FILLING CURVES
+ *    - Interleaving the bits of the quantized x, y, z gives a Morton code;
+ *      sorting by it puts every octree cell's particles in one contiguous
+ *      range, so a cell is just [begin, end) and the tree needs no per-
+ *      particle pointers
+ *
+ * 2. PARALLEL TREE BUILD
+ *    - The top levels are split sequentially until the pieces are small;
+ *      the pieces are then built concurrently into private node vectors and
+ *      spliced in with an index offset
+ *
+ * 3. CACHE LOCALITY
+ *    - Neighbouring particles (in memory, thanks to the sort) walk almost
+ *      the same cells, so the tree stays hot in cache across a work chunk
+ *
+ * See also:
+ *   ephemeris.hpp for the planetary positions used by solarSystemParticles()
+ */
+
+#include "hohmann/nbody.hpp"
+#include "hohmann/celestial_body.hpp"
+#include "hohmann/constants.hpp"
+#include "hohmann/ephemeris.hpp"
+
+#include <algorithm>    // std::sort, std::partition_point, std::min, std::max
+#include <array>        // std::array
+#include <cmath>        // std::sqrt, std::cos, std::sin, std::isfinite
+#include <limits>       // std::numeric_limits
+#include <numeric>      // std::iota
+#include <stdexcept>    // std::invalid_argument
+
+namespace hohmann {
+
+namespace {
+
+constexpr std::size_t forceGrain = 256;
+constexpr int maxLevel = 21;                       // 3 x 21 bits of Morton code
+constexpr double cellsPerAxis = 2097152.0;         // 2^21
+
+/* Spread the low 21 bits of v so that bit k moves to bit 3k */
+std::uint64_t spreadBits(std::uint64_t v) {
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffffULL;
+    v = (v | v << 16) & 0x1f0000ff0000ffULL;
+    v = (v | v << 8) & 0x100f00f00f00f00fULL;
+    v = (v | v << 4) & 0x10c30c30c30c30c3ULL;
+    v = (v | v << 2) & 0x1249249249249249ULL;
+    return v;
+}
+
+std::uint64_t quantize(double value, double origin, double scale) {
+    double cell = (value - origin) * scale;
+    return static_cast<std::uint64_t>(std::clamp(cell, 0.0, cellsPerAxis - 1.0));
+}
+
+/**
+ * Builds the octree over Morton-sorted particles
+ */
+class TreeBuilder {
+public:
+    TreeBuilder(const std::vector<std::pair<std::uint64_t, std::uint32_t>>& keys,
+                const ParticleColumns& particles, const BarnesHutOptions& options)
+        : m_keys(keys), m_particles(particles), m_options(options) {}
+
+    /* Recursively build the subtree under nodes[index], moments included */
+    void buildLocal(std::vector<OctreeNode>& nodes, std::size_t index, int level) const {
+        if (isLeaf(nodes[index], level)) {
+            leafMoments(nodes[index]);
+            return;
+        }
+        split(nodes, index, level);
+        const std::size_t first = nodes[index].firstChild;
+        const std::size_t count = nodes[index].childCount;
+        for (std::size_t c = first; c < first + count; ++c) {
+            buildLocal(nodes, c, level + 1);
+        }
+        internalMoments(nodes, index);
+    }
+
+    /*
+     * Split the top of the tree until ranges fall to `cutoff`, recording
+     * those cells in `deferred` instead of descending. Moments of the
+     * internal top cells are left for finishTop().
+     */
+    void buildTop(std::vector<OctreeNode>& nodes, std::size_t index, int level, std::size_t cutoff,
+                  std::vector<std::pair<std::size_t, int>>& deferred) const {
+        if (isLeaf(nodes[index], level)) {
+            leafMoments(nodes[index]);
+            return;
+        }
+        if (nodes[index].end - nodes[index].begin <= cutoff) {
+            deferred.emplace_back(index, level);
+            return;
+        }
+        split(nodes, index, level);
+        const std::size_t first = nodes[index].firstChild;
+        const std::size_t count = nodes[index].childCount;
+        for (std::size_t c = first; c < first + count; ++c) {
+            buildTop(nodes, c, level + 1, cutoff, deferred);
+        }
+    }
+
+    void internalMoments(std::vector<OctreeNode>& nodes, std::size_t index) const {
+        OctreeNode& node = nodes[index];
+        double gm = 0.0, x = 0.0, y = 0.0, z = 0.0;
+        for (std::size_t c = node.firstChild; c < node.firstChild + node.childCount; ++c) {
+            const OctreeNode& child = nodes[c];
+            gm += child.gm;
+            x += child.gm * child.x;
+            y += child.gm * child.y;
+            z += child.gm * child.z;
+        }
+        finishMoments(node, gm, x, y, z);
+    }
+
+private:
+    bool isLeaf(const OctreeNode& node, int level) const {
+        return node.end - node.begin <= m_options.leafSize || level == maxLevel;
+    }
+
+    int digit(std::uint64_t code, int level) const {
+        return static_cast<int>((code >> (3 * (maxLevel - 1 - level))) & 7);
+    }
+
+    /* Append the non-empty children of nodes[index] contiguously */
+    void split(std::vector<OctreeNode>& nodes, std::size_t index, int level) const {
+        const OctreeNode parent = nodes[index];
+        const double half = parent.size / 2.0;
+        const std::uint32_t first = static_cast<std::uint32_t>(nodes.size());
+        std::uint32_t count = 0;
+        auto begin = m_keys.begin() + parent.begin;
+        const auto end = m_keys.begin() + parent.end;
+        for (int octant = 0; octant < 8 && begin != end; ++octant) {
+            auto stop = std::partition_point(begin, end, [&](const auto& key) {
+                return digit(key.first, level) <= octant;
+            });
+            if (stop != begin) {
+                OctreeNode child{};
+                child.size = half;
+                child.centerX = parent.centerX + ((octant & 1) ? 0.5 : -0.5) * half;
+                child.centerY = parent.centerY + ((octant & 2) ? 0.5 : -0.5) * half;
+                child.centerZ = parent.centerZ + ((octant & 4) ? 0.5 : -0.5) * half;
+                child.begin = static_cast<std::uint32_t>(begin - m_keys.begin());
+                child.end = static_cast<std::uint32_t>(stop - m_keys.begin());
+                nodes.push_back(child);
+                ++count;
+            }
+            begin = stop;
+        }
+        nodes[index].firstChild = first;
+        nodes[index].childCount = count;
+    }
+
+    void leafMoments(OctreeNode& node) const {
+        double gm = 0.0, x = 0.0, y = 0.0, z = 0.0;
+        for (std::uint32_t i = node.begin; i < node.end; ++i) {
+            const double m = m_particles.gm[i];
+            gm += m;
+            x += m * m_particles.x[i];
+            y += m * m_particles.y[i];
+            z += m * m_particles.z[i];
+        }
+        node.childCount = 0;
+        finishMoments(node, gm, x, y, z);
+    }
+
+    void finishMoments(OctreeNode& node, double gm, double x, double y, double z) const {
+        node.gm = gm;
+        if (gm > 0.0) {
+            node.x = x / gm;
+            node.y = y / gm;
+            node.z = z / gm;
+        } else {
+            node.x = node.centerX;
+            node.y = node.centerY;
+            node.z = node.centerZ;
+        }
+        if (m_options.theta > 0.0) {
+            const double dx = node.x - node.centerX, dy = node.y - node.centerY, dz = node.z - node.centerZ;
+            const double radius = node.size / m_options.theta + std::sqrt(dx * dx + dy * dy + dz * dz);
+            node.openRadius2 = radius * radius;
+        } else {
+            node.openRadius2 = std::numeric_limits<double>::infinity();
+        }
+    }
+
+    const std::vector<std::pair<std::uint64_t, std::uint32_t>>& m_keys;
+    const ParticleColumns& m_particles;
+    const BarnesHutOptions& m_options;
+};
+
+} // namespace
+
+void ParticleColumns::resize(std::size_t count) {
+    x.resize(count);
+    y.resize(count);
+    z.resize(count);
+    vx.resize(count);
+    vy.resize(count);
+    vz.resize(count);
+    gm.resize(count);
+    id.resize(count);
+}
+
+std::uint32_t ParticleColumns::add(const Vec3& position, const Vec3& velocity, double particleGm) {
+    const auto newId = static_cast<std::uint32_t>(size());
+    x.push_back(position.x);
+    y.push_back(position.y);
+    z.push_back(position.z);
+    vx.push_back(velocity.x);
+    vy.push_back(velocity.y);
+    vz.push_back(velocity.z);
+    gm.push_back(particleGm);
+    id.push_back(newId);
+    return newId;
+}
+
+ParticleColumns solarSystemParticles(double epoch) {
+    ParticleColumns p;
+    p.add({0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, CelestialBody::Sun().gm());
+
+    const PlanetEphemeris earth = PlanetEphemeris::Earth();
+    for (const PlanetEphemeris& planet : {PlanetEphemeris::Venus(), earth}) {
+        p.add(planet.position(epoch), planet.velocity(epoch), planet.body().gm());
+    }
+
+    // Moon: circular geocentric orbit in the ecliptic
+    const CelestialBody moon = CelestialBody::Moon();
+    const double r = orbitalRadius::moon;
+    const double n = std::sqrt((earth.body().gm() + moon.gm()) / (r * r * r));
+    const double angle = meanLongitudeJ2000::moon * math::degToRad + n * epoch;
+    const Vec3 offset{r * std::cos(angle), r * std::sin(angle), 0.0};
+    const Vec3 relative{-r * n * std::sin(angle), r * n * std::cos(angle), 0.0};
+    p.add(earth.position(epoch) + offset, earth.velocity(epoch) + relative, moon.gm());
+
+    for (const PlanetEphemeris& planet : {PlanetEphemeris::Mars(), PlanetEphemeris::Jupiter()}) {
+        p.add(planet.position(epoch), planet.velocity(epoch), planet.body().gm());
+    }
+
+    // Shift to the barycentre
+    double total = 0.0;
+    Vec3 position{0.0, 0.0, 0.0}, velocity{0.0, 0.0, 0.0};
+    for (std::size_t i = 0; i < p.size(); ++i) {
+        total += p.gm[i];
+        position += p.gm[i] * p.position(i);
+        velocity += p.gm[i] * p.velocity(i);
+    }
+    position = position / total;
+    velocity = velocity / total;
+    for (std::size_t i = 0; i < p.size(); ++i) {
+        p.x[i] -= position.x;
+        p.y[i] -= position.y;
+        p.z[i] -= position.z;
+        p.vx[i] -= velocity.x;
+        p.vy[i] -= velocity.y;
+        p.vz[i] -= velocity.z;
+    }
+    return p;
+}
+
+NBodySimulation::NBodySimulation(ParticleColumns particles, BarnesHutOptions options)
+    : m_particles(std::move(particles)), m_options(options) {
+    const std::size_t n = m_particles.size();
+    if (n == 0) {
+        throw std::invalid_argument("N-body simulation needs at least one particle");
+    }
+    if (n > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("Too many particles (limit 2^32 - 1)");
+    }
+    if (m_particles.y.size() != n || m_particles.z.size() != n || m_particles.vx.size() != n
+        || m_particles.vy.size() != n || m_particles.vz.size() != n || m_particles.gm.size() != n
+        || m_particles.id.size() != n) {
+        throw std::invalid_argument("Particle columns must all have the same length");
+    }
+    if (!(m_options.theta >= 0.0) || !(m_options.softening >= 0.0)) {
+        throw std::invalid_argument("Opening angle and softening must be non-negative");
+    }
+    if (m_options.leafSize == 0) {
+        throw std::invalid_argument("Leaf size must be at least 1");
+    }
+    rebuild();
+}
+
+void NBodySimulation::rebuild() {
+    ParticleColumns& p = m_particles;
+    const std::size_t n = p.size();
+
+    // -------------------------------------------------------------------------
+    // Bounding cube and Morton codes
+    // -------------------------------------------------------------------------
+    double lo[3] = {p.x[0], p.y[0], p.z[0]};
+    double hi[3] = {lo[0], lo[1], lo[2]};
+    for (std::size_t i = 1; i < n; ++i) {
+        lo[0] = std::min(lo[0], p.x[i]);
+        hi[0] = std::max(hi[0], p.x[i]);
+        lo[1] = std::min(lo[1], p.y[i]);
+        hi[1] = std::max(hi[1], p.y[i]);
+        lo[2] = std::min(lo[2], p.z[i]);
+        hi[2] = std::max(hi[2], p.z[i]);
+    }
+    double size = std::max({hi[0] - lo[0], hi[1] - lo[1], hi[2] - lo[2]});
+    size = size > 0.0 ? size * (1.0 + 1e-12) : 1.0;
+    const double scale = cellsPerAxis / size;
+
+    m_keys.resize(n);
+    TaskScheduler::global().parallelFor(0, n, batchGrain, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            std::uint64_t code = spreadBits(quantize(p.x[i], lo[0], scale))
+                               | spreadBits(quantize(p.y[i], lo[1], scale)) << 1
+                               | spreadBits(quantize(p.z[i], lo[2], scale)) << 2;
+            m_keys[i] = {code, static_cast<std::uint32_t>(i)};
+        }
+    });
+    // After the first step the order barely changes, so the sort is cheap
+    std::sort(m_keys.begin(), m_keys.end());
+
+    // -------------------------------------------------------------------------
+    // Reorder every column along the curve
+    // -------------------------------------------------------------------------
+    ParticleColumns& s = m_scratch;
+    s.resize(n);
+    TaskScheduler::global().parallelFor(0, n, batchGrain, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            const std::uint32_t from = m_keys[i].second;
+            s.x[i] = p.x[from];
+            s.y[i] = p.y[from];
+            s.z[i] = p.z[from];
+            s.vx[i] = p.vx[from];
+            s.vy[i] = p.vy[from];
+            s.vz[i] = p.vz[from];
+            s.gm[i] = p.gm[from];
+            s.id[i] = p.id[from];
+        }
+    });
+    std::swap(m_particles, m_scratch);
+
+    // -------------------------------------------------------------------------
+    // Octree: sequential top, parallel subtrees, then splice
+    // -------------------------------------------------------------------------
+    TreeBuilder builder(m_keys, m_particles, m_options);
+    m_tree.clear();
+    OctreeNode root{};
+    root.size = size;
+    root.centerX = lo[0] + size / 2.0;
+    root.centerY = lo[1] + size / 2.0;
+    root.centerZ = lo[2] + size / 2.0;
+    root.begin = 0;
+    root.end = static_cast<std::uint32_t>(n);
+    m_tree.push_back(root);
+
+    const std::size_t cutoff = std::max<std::size_t>(4096, n / 64);
+    std::vector<std::pair<std::size_t, int>> deferred;
+    builder.buildTop(m_tree, 0, 0, cutoff, deferred);
+    const std::size_t topCount = m_tree.size();
+
+    std::vector<std::vector<OctreeNode>> subtrees(deferred.size());
+    TaskScheduler::global().parallelFor(0, deferred.size(), 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t k = first; k < last; ++k) {
+            subtrees[k].push_back(m_tree[deferred[k].first]);
+            builder.buildLocal(subtrees[k], 0, deferred[k].second);
+        }
+    });
+
+    std::vector<char> isDeferred(topCount, 0);
+    for (std::size_t k = 0; k < deferred.size(); ++k) {
+        const std::size_t target = deferred[k].first;
+        isDeferred[target] = 1;
+        // Local index j >= 1 lands at base + j - 1
+        const auto shift = static_cast<std::uint32_t>(m_tree.size() - 1);
+        std::vector<OctreeNode>& local = subtrees[k];
+        for (std::size_t j = 1; j < local.size(); ++j) {
+            OctreeNode node = local[j];
+            if (node.childCount > 0) {
+                node.firstChild += shift;
+            }
+            m_tree.push_back(node);
+        }
+        OctreeNode top = local[0];
+        if (top.childCount > 0) {
+            top.firstChild += shift;
+        }
+        m_tree[target] = top;
+    }
+    // Top cells were created parent-first, so reverse order is post-order
+    for (std::size_t i = topCount; i-- > 0;) {
+        if (!isDeferred[i] && m_tree[i].childCount > 0) {
+            builder.internalMoments(m_tree, i);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Accelerations: one tree walk per particle
+    // -------------------------------------------------------------------------
+    m_ax.resize(n);
+    m_ay.resize(n);
+    m_az.resize(n);
+    const double eps2 = m_options.softening * m_options.softening;
+    const std::vector<OctreeNode>& tree = m_tree;
+    TaskScheduler::global().parallelFor(0, n, forceGrain, [&](std::size_t first, std::size_t last) {
+        std::array<std::uint32_t, 8 * maxLevel + 8> stack;
+        for (std::size_t i = first; i < last; ++i) {
+            const double px = m_particles.x[i], py = m_particles.y[i], pz = m_particles.z[i];
+            double ax = 0.0, ay = 0.0, az = 0.0;
+            std::size_t top = 0;
+            stack[top++] = 0;
+            while (top > 0) {
+                const OctreeNode& node = tree[stack[--top]];
+                if (node.gm == 0.0) {
+                    continue;
+                }
+                const double dx = node.x - px, dy = node.y - py, dz = node.z - pz;
+                const double d2 = dx * dx + dy * dy + dz * dz;
+                const bool contains = i >= node.begin && i < node.end;
+                if (!contains && d2 > node.openRadius2) {
+                    const double r2 = d2 + eps2;
+                    const double k = node.gm / (r2 * std::sqrt(r2));
+                    ax += k * dx;
+                    ay += k * dy;
+                    az += k * dz;
+                } else if (node.childCount == 0) {
+                    for (std::uint32_t j = node.begin; j < node.end; ++j) {
+                        const double gm = m_particles.gm[j];
+                        if (j == i || gm == 0.0) {
+                            continue;
+                        }
+                        const double ex = m_particles.x[j] - px;
+                        const double ey = m_particles.y[j] - py;
+                        const double ez = m_particles.z[j] - pz;
+                        const double r2 = ex * ex + ey * ey + ez * ez + eps2;
+                        const double k = gm / (r2 * std::sqrt(r2));
+                        ax += k * ex;
+                        ay += k * ey;
+                        az += k * ez;
+                    }
+                } else {
+                    for (std::uint32_t c = 0; c < node.childCount; ++c) {
+                        stack[top++] = node.firstChild + c;
+                    }
+                }
+            }
+            m_ax[i] = ax;
+            m_ay[i] = ay;
+            m_az[i] = az;
+        }
+    });
+}
+
+void NBodySimulation::step(double dt) {
+    if (!(dt > 0.0)) {
+        throw std::invalid_argument("Time step must be positive");
+    }
+    ParticleColumns& p = m_particles;
+    const std::size_t n = p.size();
+    const double half = dt / 2.0;
+
+    // Kick, drift
+    TaskScheduler::global().parallelFor(0, n, batchGrain, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            p.vx[i] += half * m_ax[i];
+            p.vy[i] += half * m_ay[i];
+            p.vz[i] += half * m_az[i];
+            p.x[i] += dt * p.vx[i];
+            p.y[i] += dt * p.vy[i];
+            p.z[i] += dt * p.vz[i];
+        }
+    });
+    m_time += dt;
+
+    rebuild();
+
+    // Kick with the new accelerations (already in the new particle order)
+    TaskScheduler::global().parallelFor(0, n, batchGrain, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            m_particles.vx[i] += half * m_ax[i];
+            m_particles.vy[i] += half * m_ay[i];
+            m_particles.vz[i] += half * m_az[i];
+        }
+    });
+}
+
+std::size_t NBodySimulation::run(double dt, std::size_t steps, const CancellationToken* token) {
+    for (std::size_t s = 0; s < steps; ++s) {
+        if (token && token->cancelled()) {
+            return s;
+        }
+        step(dt);
+    }
+    return steps;
+}
+
+double NBodySimulation::energy() const {
+    const ParticleColumns& p = m_particles;
+    std::vector<std::size_t> massive;
+    for (std::size_t i = 0; i < p.size(); ++i) {
+        if (p.gm[i] != 0.0) {
+            massive.push_back(i);
+        }
+    }
+    const double eps2 = m_options.softening * m_options.softening;
+    double kinetic = 0.0, potential = 0.0;
+    for (std::size_t a = 0; a < massive.size(); ++a) {
+        const std::size_t i = massive[a];
+        kinetic += 0.5 * p.gm[i] * (p.vx[i] * p.vx[i] + p.vy[i] * p.vy[i] + p.vz[i] * p.vz[i]);
+        for (std::size_t b = a + 1; b < massive.size(); ++b) {
+            const std::size_t j = massive[b];
+            const double dx = p.x[i] - p.x[j], dy = p.y[i] - p.y[j], dz = p.z[i] - p.z[j];
+            potential -= p.gm[i] * p.gm[j] / std::sqrt(dx * dx + dy * dy + dz * dz + eps2);
+        }
+    }
+    return kinetic + potential;
+}
+
+ParticleColumns NBodySimulation::particlesById() const {
+    const ParticleColumns& p = m_particles;
+    std::vector<std::size_t> order(p.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::sort(order.begin(), order.end(), [&p](std::size_t a, std::size_t b) { return p.id[a] < p.id[b]; });
+    ParticleColumns out;
+    out.resize(p.size());
+    for (std::size_t k = 0; k < order.size(); ++k) {
+        const std::size_t i = order[k];
+        out.x[k] = p.x[i];
+        out.y[k] = p.y[i];
+        out.z[k] = p.z[i];
+        out.vx[k] = p.vx[i];
+        out.vy[k] = p.vy[i];
+        out.vz[k] = p.vz[i];
+        out.gm[k] = p.gm[i];
+        out.id[k] = p.id[i];
+    }
+    return out;
+}
+
+} // namespace hohmann
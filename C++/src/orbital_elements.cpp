@@ -0,0 +1,330 @@
+/*
+ * orbital_elements.cpp - Conversions between Keplerian elements and Cartesian states
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Two Ways to Describe the Same Orbit
+ * ==============================================================================
+ *
+ * An orbit (plus a position on it) has six degrees of freedom. There are two
+ * standard ways to spend those six numbers:
+ *
+ *   CARTESIAN STATE VECTOR            CLASSICAL (KEPLERIAN) ELEMENTS
+ *   ----------------------            ------------------------------
+ *   r = (x, y, z)     position        a      size of the ellipse
+ *   v = (vx, vy, vz)  velocity        e      shape (0 = circle)
+ *                                     i      tilt of the orbit plane
+ *                                     RAAN   where the plane crosses the equator
+ *                                     omega  where periapsis sits in the plane
+ *                                     nu     where the spacecraft is right now
+ *
+ * Propagators and sensors speak Cartesian; mission designers speak elements.
+ * A catalogue tool has to move between the two constantly.
+ *
+ *                  z (north)
+ *                  |        orbit plane
+ *                  |      /
+ *                  |    /  h = r x v (angular momentum, normal to the plane)
+ *                  |  /
+ *                  |/_________ y
+ *                 / \
+ *                /   \  <- line of nodes (n = z x h), angle RAAN from +x
+ *               x
+ *
+ * ELEMENTS -> STATE:
+ *   Write r and v in the "perifocal" frame (x toward periapsis) then rotate
+ *   by omega, i, RAAN. Closed form, no iteration.
+ *
+ * STATE -> ELEMENTS:
+ *   h = r x v                             angular momentum vector
+ *   n = z x h                             node vector
+ *   e = ((v^2 - mu/r) r - (r.v) v) / mu   eccentricity vector (points at periapsis)
+ *   a = -mu / (2 * energy)                from vis-viva
+ *
+ * THE SINGULARITIES:
+ *   - Circular orbit: e = 0, so there is no periapsis and omega is undefined.
+ *   - Equatorial orbit: n = 0, so there is no node line and RAAN is undefined.
+ * Textbook acos() formulas blow up (or silently flip quadrant) near these
+ * cases - exactly the GEO belt and most LEO constellations. We instead pick a
+ * fallback reference direction (node line -> +x axis, periapsis -> node line)
+ * and measure every angle with atan2 of a sine/cosine pair, which is
+ * well-conditioned all the way down to zero.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. STRUCTURE OF ARRAYS (SoA)
+ *    - KeplerianElementsArray stores one std::vector per element, not a
+ *      std::vector<KeplerianElements>
+ *    - Batch loops touch only the columns they need, in order, so hardware
+ *      prefetchers and SIMD units work at full speed
+ *
+ * 2. ANONYMOUS NAMESPACES
+ *    - The conversion kernels live in `namespace { }` so they are private to
+ *      this translation unit; the scalar and batch APIs share one copy
+ *
+ * 3. REUSING OUTPUT BUFFERS
+ *    - std::vector::resize() to the current size is a no-op, so converting
+ *      repeatedly into the same arrays allocates nothing after the first call
+ *
+ * See also:
+ *   orbital_elements.hpp for the public types
+ *   vector3.hpp for the Vec3 helpers
+ */
+
+#include "hohmann/orbital_elements.hpp"
+#include "hohmann/constants.hpp"
+
+#include <cmath>    // std::sin, std::cos, std::atan2, std::sqrt
+
+namespace hohmann {
+
+namespace {
+
+// Below this relative size e (or sin i) is treated as exactly zero
+constexpr double singularityTolerance = 1e-11;
+
+/**
+ * Elements -> state kernel shared by the scalar and batch entry points.
+ *
+ * The columns of the perifocal-to-inertial rotation matrix (P toward
+ * periapsis, Q 90 degrees ahead in the direction of motion) are built
+ * directly instead of multiplying three rotation matrices.
+ */
+inline StateVector elementsToState(double a, double e, double inc, double raan,
+                                   double argp, double nu, double mu) {
+    double cos_raan = std::cos(raan), sin_raan = std::sin(raan);
+    double cos_argp = std::cos(argp), sin_argp = std::sin(argp);
+    double cos_inc = std::cos(inc), sin_inc = std::sin(inc);
+    double cos_nu = std::cos(nu), sin_nu = std::sin(nu);
+
+    Vec3 p_hat{cos_raan * cos_argp - sin_raan * sin_argp * cos_inc,
+               sin_raan * cos_argp + cos_raan * sin_argp * cos_inc,
+               sin_argp * sin_inc};
+    Vec3 q_hat{-cos_raan * sin_argp - sin_raan * cos_argp * cos_inc,
+               -sin_raan * sin_argp + cos_raan * cos_argp * cos_inc,
+               cos_argp * sin_inc};
+
+    // Conic equation r = p / (1 + e cos nu), with p the semi-latus rectum
+    double p = a * (1.0 - e * e);
+    double r = p / (1.0 + e * cos_nu);
+    double v_scale = std::sqrt(mu / p);
+
+    StateVector state;
+    state.position = p_hat * (r * cos_nu) + q_hat * (r * sin_nu);
+    state.velocity = p_hat * (-v_scale * sin_nu) + q_hat * (v_scale * (e + cos_nu));
+    return state;
+}
+
+/**
+ * Signed angle from `from` to `to`, measured about the unit normal `axis`.
+ *
+ * atan2(sin, cos) stays accurate for every quadrant, unlike acos() which
+ * loses half its digits near 0 and pi and needs a separate sign test.
+ */
+inline double angleAbout(const Vec3& from, const Vec3& to, const Vec3& axis) {
+    double angle = std::atan2(dot(cross(from, to), axis), dot(from, to));
+    return angle < 0.0 ? angle + math::twoPi : angle;
+}
+
+/**
+ * State -> elements kernel with circular/equatorial fallbacks.
+ */
+inline KeplerianElements stateToElements(const Vec3& r, const Vec3& v, double mu) {
+    double r_mag = norm(r);
+    double v_sq = dot(v, v);
+
+    Vec3 h = cross(r, v);
+    double h_mag = norm(h);
+    Vec3 h_hat = h / h_mag;
+
+    // Node vector n = z x h; zero length for equatorial orbits
+    Vec3 n{-h.y, h.x, 0.0};
+    double n_mag = norm(n);
+
+    Vec3 e_vec = (r * (v_sq - mu / r_mag) - v * dot(r, v)) / mu;
+    double e = norm(e_vec);
+
+    KeplerianElements elements;
+    elements.semiMajorAxis = -mu / (2.0 * (0.5 * v_sq - mu / r_mag));
+    elements.eccentricity = e;
+    elements.inclination = std::atan2(n_mag, h.z);
+
+    // Reference direction in the orbit plane: the ascending node, or +x
+    // when the orbit lies in the equator and there is no node line
+    bool equatorial = n_mag < singularityTolerance * h_mag;
+    Vec3 node_dir = equatorial ? Vec3{1.0, 0.0, 0.0} : n / n_mag;
+    elements.raan = equatorial ? 0.0 : angleAbout(Vec3{1.0, 0.0, 0.0}, node_dir, Vec3{0.0, 0.0, 1.0});
+
+    if (e < singularityTolerance) {
+        // Circular: no periapsis, so measure position straight from the node
+        elements.argumentOfPeriapsis = 0.0;
+        elements.trueAnomaly = angleAbout(node_dir, r, h_hat);
+    } else {
+        elements.argumentOfPeriapsis = angleAbout(node_dir, e_vec, h_hat);
+        elements.trueAnomaly = angleAbout(e_vec, r, h_hat);
+    }
+    return elements;
+}
+
+} // namespace
+
+// =============================================================================
+// KEPLERIAN ELEMENTS
+// =============================================================================
+
+/**
+ * Build elements for a circular Orbit.
+ *
+ * The existing Orbit class only knows its radius, so this is the bridge from
+ * the Hohmann world (coplanar circles) into full 3D orbit geometry.
+ */
+KeplerianElements KeplerianElements::fromOrbit(const Orbit& orbit, double inclination,
+                                               double raan, double argumentOfLatitude) {
+    KeplerianElements elements;
+    elements.semiMajorAxis = orbit.radius();
+    elements.eccentricity = 0.0;
+    elements.inclination = inclination;
+    elements.raan = raan;
+    elements.argumentOfPeriapsis = 0.0;
+    elements.trueAnomaly = argumentOfLatitude;
+    return elements;
+}
+
+// =============================================================================
+// STRUCTURE-OF-ARRAYS CONTAINERS
+// =============================================================================
+
+void KeplerianElementsArray::resize(std::size_t count) {
+    semiMajorAxis.resize(count);
+    eccentricity.resize(count);
+    inclination.resize(count);
+    raan.resize(count);
+    argumentOfPeriapsis.resize(count);
+    trueAnomaly.resize(count);
+}
+
+KeplerianElements KeplerianElementsArray::at(std::size_t index) const {
+    return {semiMajorAxis[index], eccentricity[index], inclination[index],
+            raan[index], argumentOfPeriapsis[index], trueAnomaly[index]};
+}
+
+void KeplerianElementsArray::set(std::size_t index, const KeplerianElements& elements) {
+    semiMajorAxis[index] = elements.semiMajorAxis;
+    eccentricity[index] = elements.eccentricity;
+    inclination[index] = elements.inclination;
+    raan[index] = elements.raan;
+    argumentOfPeriapsis[index] = elements.argumentOfPeriapsis;
+    trueAnomaly[index] = elements.trueAnomaly;
+}
+
+void StateVectorArray::resize(std::size_t count) {
+    x.resize(count);
+    y.resize(count);
+    z.resize(count);
+    vx.resize(count);
+    vy.resize(count);
+    vz.resize(count);
+}
+
+StateVector StateVectorArray::at(std::size_t index) const {
+    return {{x[index], y[index], z[index]}, {vx[index], vy[index], vz[index]}};
+}
+
+void StateVectorArray::set(std::size_t index, const StateVector& state) {
+    x[index] = state.position.x;
+    y[index] = state.position.y;
+    z[index] = state.position.z;
+    vx[index] = state.velocity.x;
+    vy[index] = state.velocity.y;
+    vz[index] = state.velocity.z;
+}
+
+// =============================================================================
+// CONVERSIONS
+// =============================================================================
+
+StateVector keplerianToCartesian(const KeplerianElements& elements, double mu) {
+    return elementsToState(elements.semiMajorAxis, elements.eccentricity,
+                           elements.inclination, elements.raan,
+                           elements.argumentOfPeriapsis, elements.trueAnomaly, mu);
+}
+
+KeplerianElements cartesianToKeplerian(const StateVector& state, double mu) {
+    return stateToElements(state.position, state.velocity, mu);
+}
+
+/**
+ * Batch elements -> states.
+ *
+ * PERFORMANCE NOTE:
+ * -----------------
+ * Raw column pointers are hoisted out of the loop so the compiler can see
+ * the loads/stores never alias the std::vector bookkeeping. Each iteration
+ * is independent, which is what makes this easy to split across threads
+ * later without changing the kernel.
+ */
+void keplerianToCartesian(const KeplerianElementsArray& elements, double mu,
+                          StateVectorArray& states) {
+    const std::size_t count = elements.size();
+    states.resize(count);
+
+    const double* a = elements.semiMajorAxis.data();
+    const double* e = elements.eccentricity.data();
+    const double* inc = elements.inclination.data();
+    const double* raan = elements.raan.data();
+    const double* argp = elements.argumentOfPeriapsis.data();
+    const double* nu = elements.trueAnomaly.data();
+
+    double* x = states.x.data();
+    double* y = states.y.data();
+    double* z = states.z.data();
+    double* vx = states.vx.data();
+    double* vy = states.vy.data();
+    double* vz = states.vz.data();
+
+    for (std::size_t k = 0; k < count; ++k) {
+        StateVector s = elementsToState(a[k], e[k], inc[k], raan[k], argp[k], nu[k], mu);
+        x[k] = s.position.x;
+        y[k] = s.position.y;
+        z[k] = s.position.z;
+        vx[k] = s.velocity.x;
+        vy[k] = s.velocity.y;
+        vz[k] = s.velocity.z;
+    }
+}
+
+/**
+ * Batch states -> elements (same layout rules as above).
+ */
+void cartesianToKeplerian(const StateVectorArray& states, double mu,
+                          KeplerianElementsArray& elements) {
+    const std::size_t count = states.size();
+    elements.resize(count);
+
+    const double* x = states.x.data();
+    const double* y = states.y.data();
+    const double* z = states.z.data();
+    const double* vx = states.vx.data();
+    const double* vy = states.vy.data();
+    const double* vz = states.vz.data();
+
+    double* a = elements.semiMajorAxis.data();
+    double* e = elements.eccentricity.data();
+    double* inc = elements.inclination.data();
+    double* raan = elements.raan.data();
+    double* argp = elements.argumentOfPeriapsis.data();
+    double* nu = elements.trueAnomaly.data();
+
+    for (std::size_t k = 0; k < count; ++k) {
+        KeplerianElements el = stateToElements({x[k], y[k], z[k]}, {vx[k], vy[k], vz[k]}, mu);
+        a[k] = el.semiMajorAxis;
+        e[k] = el.eccentricity;
+        inc[k] = el.inclination;
+        raan[k] = el.raan;
+        argp[k] = el.argumentOfPeriapsis;
+        nu[k] = el.trueAnomaly;
+    }
+}
+
+} // namespace hohmann
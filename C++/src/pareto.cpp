@@ -0,0 +1,160 @@
+/*
+ * pareto.cpp - Pareto-front extraction
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Trade Studies
+ * ==============================================================================
+ *
+ * Faster transfers cost more delta-v. A sweep produces millions of designs,
+ * but only those on the "efficient frontier" matter: for each flight time,
+ * the cheapest design; for each budget, the fastest.
+ *
+ *      delta-v
+ *        |  *
+ *        |   o  *          o = on the front (non-dominated)
+ *        |    o     *      * = dominated (something is cheaper AND faster)
+ *        |      o    *
+ *        |         o   o
+ *        +-------------------- time of flight
+ *
+ * ==============================================================================
+ * ALGORITHM
+ * ==============================================================================
+ *
+ * Sort by time (ties: by cost), then sweep once keeping each point cheaper
+ * than everything before it. That is O(n log n) for the sort and O(n) for
+ * the sweep.
+ *
+ * For very large inputs the sort dominates and is split: each chunk finds its
+ * own front in parallel. A chunk front is tiny compared to the chunk, and
+ * the global front is the front of the union of chunk fronts, so fronts are
+ * merged pairwise (merge two sorted lists + sweep) up a binary tree.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. SORTING SMALL RECORDS INSTEAD OF INDICES
+ *    - Copying (time, cost, index) into a chunk-local vector lets std::sort
+ *      compare contiguous data instead of chasing indices into two columns
+ *
+ * 2. std::merge
+ *    - Two already-sorted fronts combine in linear time
+ */
+
+#include "hohmann/pareto.hpp"
+#include "hohmann/scheduler.hpp"
+
+#include <algorithm>    // std::sort, std::merge, std::max, std::min
+#include <cmath>        // std::isnan
+#include <iterator>     // std::back_inserter
+#include <limits>       // std::numeric_limits
+
+namespace hohmann {
+
+namespace {
+
+// Points per chunk: big enough to amortize a task, small enough to stay in cache
+constexpr std::size_t minChunk = 1 << 16;
+constexpr std::size_t maxChunk = 1 << 20;
+
+struct FrontPoint {
+    double time;
+    double cost;
+    std::size_t index;
+};
+
+bool earlier(const FrontPoint& a, const FrontPoint& b) {
+    if (a.time != b.time) {
+        return a.time < b.time;
+    }
+    if (a.cost != b.cost) {
+        return a.cost < b.cost;
+    }
+    return a.index < b.index;
+}
+
+/* Keep points strictly cheaper than every earlier point (input sorted) */
+std::vector<FrontPoint> sweep(const std::vector<FrontPoint>& sorted) {
+    std::vector<FrontPoint> front;
+    double best = std::numeric_limits<double>::infinity();
+    for (const auto& p : sorted) {
+        if (p.cost < best) {
+            front.push_back(p);
+            best = p.cost;
+        }
+    }
+    return front;
+}
+
+std::vector<FrontPoint> chunkFront(const double* cost, const double* time,
+                                   std::size_t first, std::size_t last) {
+    std::vector<FrontPoint> points;
+    points.reserve(last - first);
+    for (std::size_t k = first; k < last; ++k) {
+        if (!std::isnan(cost[k]) && !std::isnan(time[k])) {
+            points.push_back({time[k], cost[k], k});
+        }
+    }
+    std::sort(points.begin(), points.end(), earlier);
+    return sweep(points);
+}
+
+std::vector<FrontPoint> mergeFronts(const std::vector<FrontPoint>& a,
+                                    const std::vector<FrontPoint>& b) {
+    std::vector<FrontPoint> merged;
+    merged.reserve(a.size() + b.size());
+    std::merge(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(merged), earlier);
+    return sweep(merged);
+}
+
+} // namespace
+
+std::vector<std::size_t> paretoFront(const double* cost, const double* time,
+                                     std::size_t count) {
+    TaskScheduler& scheduler = TaskScheduler::global();
+
+    // -------------------------------------------------------------------------
+    // Local fronts, one per chunk, in parallel
+    // -------------------------------------------------------------------------
+    std::size_t chunk = (count + scheduler.workerCount() * 4 - 1) / (scheduler.workerCount() * 4);
+    chunk = std::min(maxChunk, std::max(minChunk, chunk));
+    const std::size_t chunks = count == 0 ? 0 : (count + chunk - 1) / chunk;
+
+    std::vector<std::vector<FrontPoint>> fronts(chunks);
+    scheduler.parallelFor(0, chunks, 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t c = first; c < last; ++c) {
+            fronts[c] = chunkFront(cost, time, c * chunk, std::min(count, (c + 1) * chunk));
+        }
+    });
+
+    // -------------------------------------------------------------------------
+    // Divide-and-conquer merge: halve the number of fronts each level
+    // -------------------------------------------------------------------------
+    while (fronts.size() > 1) {
+        std::vector<std::vector<FrontPoint>> next((fronts.size() + 1) / 2);
+        scheduler.parallelFor(0, next.size(), 1, [&](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                next[i] = 2 * i + 1 < fronts.size()
+                    ? mergeFronts(fronts[2 * i], fronts[2 * i + 1])
+                    : std::move(fronts[2 * i]);
+            }
+        });
+        fronts = std::move(next);
+    }
+
+    std::vector<std::size_t> indices;
+    if (!fronts.empty()) {
+        indices.reserve(fronts[0].size());
+        for (const auto& p : fronts[0]) {
+            indices.push_back(p.index);
+        }
+    }
+    return indices;
+}
+
+std::vector<std::size_t> paretoFront(const TransferColumns& columns) {
+    return paretoFront(columns.totalDeltaV.data(), columns.transferTime.data(), columns.size());
+}
+
+} // namespace hohmann
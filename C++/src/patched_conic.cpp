@@ -0,0 +1,199 @@
+/*
+ * patched_conic.cpp - Hyperbolic departure and capture around a heliocentric transfer
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: The Patched-Conic Approximation
+ * ==============================================================================
+ *
+ * An Earth-Mars trajectory feels Earth, the Sun and Mars all at once. The
+ * patched-conic method splits it into three two-body problems and "patches"
+ * them together at the planets' spheres of influence (SOI):
+ *
+ *      Earth SOI               Heliocentric ellipse              Mars SOI
+ *    .-----------.    ----------------------------------->    .----------.
+ *   | hyperbola   |   v_inf,dep                  v_inf,arr   |  hyperbola |
+ *   |  (depart)   |   = HohmannTransfer dv1      = dv2       |  (capture) |
+ *    '-----------'                                            '----------'
+ *
+ * 1. HELIOCENTRIC LEG: the HohmannTransfer between the planets' orbits. Its
+ *    dv1 is the speed the spacecraft must have RELATIVE TO EARTH once it has
+ *    climbed out of Earth's gravity well - the hyperbolic excess speed v_inf.
+ *    Likewise dv2 is the speed relative to Mars on arrival.
+ *
+ * 2. PLANETOCENTRIC HYPERBOLAS: energy conservation on a hyperbola gives the
+ *    speed at periapsis radius r_p:
+ *
+ *        v_p = sqrt(v_inf^2 + 2 * mu / r_p)
+ *
+ *    Because v_p only grows like sqrt(v_inf^2 + v_esc^2), one burn at
+ *    periapsis is far cheaper than escaping first and then adding v_inf in
+ *    deep space: ~3.6 km/s versus ~6.1 km/s from LEO (the Oberth effect).
+ *
+ * 3. THE BURNS (both at periapsis, both tangential):
+ *
+ *        departure: dv = sqrt(v_inf^2 + 2mu/r_p) - sqrt(mu / r_p)
+ *        capture:   dv = sqrt(v_inf^2 + 2mu/r_p) - sqrt(mu (1 + e) / r_p)
+ *
+ *    The second term is the periapsis speed of the orbit we leave/enter.
+ *    Capturing into an ellipse (e > 0) is much cheaper than into a circle,
+ *    which is why real Mars orbiters capture loosely and aerobrake down.
+ *
+ * For Earth -> Mars from a 400 km LEO into a 400 km Mars orbit this gives
+ * ~3.6 km/s departure and ~2.1 km/s capture - the textbook numbers.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. COMPOSITION
+ *    - PatchedConicMission HAS-A HohmannTransfer rather than re-deriving
+ *      the heliocentric math
+ *
+ * 2. SEPARABLE BATCH EVALUATION
+ *    - Departure cost depends only on the row, capture only on the column,
+ *      so an N x M table costs N + M square roots plus N x M additions
+ *
+ * See also:
+ *   hohmann_transfer.hpp for the heliocentric leg
+ *   examples/earth_mars.cpp for a complete mission budget
+ */
+
+#include "hohmann/patched_conic.hpp"
+
+#include <cmath>        // std::sqrt, std::abs
+#include <stdexcept>    // std::invalid_argument
+
+namespace hohmann {
+
+namespace {
+
+/* Same-body test used throughout the library (see HohmannTransfer) */
+bool sameBody(const CelestialBody& a, const CelestialBody& b) {
+    return std::abs(a.gm() - b.gm()) <= 1.0;
+}
+
+/* A capture orbit must be bound and clear the arrival planet's surface */
+void checkCapture(const CaptureOrbit& capture, const CelestialBody& arrival) {
+    if (!(capture.periapsisRadius > 0.0) || !(capture.eccentricity >= 0.0 && capture.eccentricity < 1.0)) {
+        throw std::invalid_argument(
+            "Capture orbit needs positive periapsis radius and 0 <= e < 1");
+    }
+    if (arrival.radius() && capture.periapsisRadius < *arrival.radius()) {
+        throw std::invalid_argument(
+            "Capture periapsis is below the arrival body's surface");
+    }
+}
+
+} // namespace
+
+// =============================================================================
+// HYPERBOLIC BURNS
+// =============================================================================
+
+double hyperbolicPeriapsisDeltaV(double vInfinity, double mu,
+                                 double periapsisRadius, double eccentricity) {
+    double v_hyperbolic = std::sqrt(vInfinity * vInfinity + 2.0 * mu / periapsisRadius);
+    double v_bound = std::sqrt(mu * (1.0 + eccentricity) / periapsisRadius);
+    return v_hyperbolic - v_bound;
+}
+
+// =============================================================================
+// CONSTRUCTOR
+// =============================================================================
+
+PatchedConicMission::PatchedConicMission(const HohmannTransfer& heliocentric,
+                                         const CelestialBody& departureBody,
+                                         const CelestialBody& arrivalBody)
+    : m_transfer(heliocentric),
+      m_departureBody(departureBody),
+      m_arrivalBody(arrivalBody) {
+    const CelestialBody& central = heliocentric.initialOrbit().body();
+    if (sameBody(departureBody, central) || sameBody(arrivalBody, central)) {
+        throw std::invalid_argument(
+            "Departure and arrival planets cannot be the transfer's central body");
+    }
+}
+
+// =============================================================================
+// SINGLE-MISSION QUERIES
+// =============================================================================
+
+double PatchedConicMission::departureDeltaV(const Orbit& parking) const {
+    if (!sameBody(parking.body(), m_departureBody)) {
+        throw std::invalid_argument(
+            "Parking orbit must be around the departure body");
+    }
+    return hyperbolicPeriapsisDeltaV(departureVInfinity(), m_departureBody.gm(),
+                                     parking.radius(), 0.0);
+}
+
+double PatchedConicMission::captureDeltaV(const CaptureOrbit& capture) const {
+    checkCapture(capture, m_arrivalBody);
+    return hyperbolicPeriapsisDeltaV(arrivalVInfinity(), m_arrivalBody.gm(),
+                                     capture.periapsisRadius, capture.eccentricity);
+}
+
+double PatchedConicMission::captureDeltaV(const Orbit& target) const {
+    if (!sameBody(target.body(), m_arrivalBody)) {
+        throw std::invalid_argument(
+            "Capture orbit must be around the arrival body");
+    }
+    return captureDeltaV(CaptureOrbit{target.radius(), 0.0});
+}
+
+// =============================================================================
+// MISSION TABLE
+// =============================================================================
+
+/**
+ * Build the full parking x capture delta-v table in one call.
+ *
+ * Departure and capture burns are priced once per row / column with the
+ * same hyperbolicPeriapsisDeltaV() the single-mission queries use; only the
+ * rows x columns sum is expanded.
+ */
+MissionDeltaVTable PatchedConicMission::deltaVTable(
+        const std::vector<double>& parkingRadii,
+        const std::vector<CaptureOrbit>& captureOrbits) const {
+    for (double r : parkingRadii) {
+        if (!(r > 0.0)) {
+            throw std::invalid_argument("Parking orbit radius must be positive");
+        }
+    }
+    for (const auto& c : captureOrbits) {
+        checkCapture(c, m_arrivalBody);
+    }
+
+    MissionDeltaVTable table;
+    table.parkingRadius = parkingRadii;
+    table.captureOrbit = captureOrbits;
+    table.heliocentricTransferTime = m_transfer.result().transferTime;
+
+    const std::size_t rows = parkingRadii.size();
+    const std::size_t cols = captureOrbits.size();
+
+    table.departureDeltaV.resize(rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        table.departureDeltaV[i] = hyperbolicPeriapsisDeltaV(departureVInfinity(), m_departureBody.gm(),
+                                                             parkingRadii[i], 0.0);
+    }
+
+    table.captureDeltaV.resize(cols);
+    for (std::size_t j = 0; j < cols; ++j) {
+        table.captureDeltaV[j] = hyperbolicPeriapsisDeltaV(arrivalVInfinity(), m_arrivalBody.gm(),
+                                                           captureOrbits[j].periapsisRadius,
+                                                           captureOrbits[j].eccentricity);
+    }
+
+    table.totalDeltaV.resize(rows * cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+        double dep = table.departureDeltaV[i];
+        double* row = table.totalDeltaV.data() + i * cols;
+        for (std::size_t j = 0; j < cols; ++j) {
+            row[j] = dep + table.captureDeltaV[j];
+        }
+    }
+    return table;
+}
+
+} // namespace hohmann
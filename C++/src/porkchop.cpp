@@ -0,0 +1,155 @@
+/*
+ * porkchop.cpp - Launch-date x time-of-flight Lambert grids
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Porkchop Plots
+ * ==============================================================================
+ *
+ * Plot launch date on one axis, arrival date (or flight time) on the other,
+ * and contour the departure C3 or v_inf. The closed contours look like a
+ * pork chop - hence the name. Every Mars, Venus and Jupiter mission starts
+ * from one of these:
+ *
+ *     time of |       .-~~~-.
+ *     flight  |     /  .-.    \        Inner contours = cheapest launches
+ *             |    |  ( o )    |       The "o" is the optimum
+ *             |     \  '-'    /
+ *             |       '-...-'
+ *             +------------------ departure date
+ *
+ * Each grid point is one Lambert solve between the departure planet at the
+ * launch date and the arrival planet at launch + time of flight.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. ONE PER-CASE FUNCTION, TWO DRIVERS
+ *    - evaluateCase() is shared by the full-grid and top-k drivers, so both
+ *      produce identical numbers for the same grid point
+ *
+ * See also:
+ *   lambert.hpp for the arc solver
+ *   top_k.hpp for the streaming reducer
+ */
+
+#include "hohmann/porkchop.hpp"
+#include "hohmann/constants.hpp"
+#include "hohmann/lambert.hpp"
+#include "hohmann/scheduler.hpp"
+
+#include <limits>       // std::numeric_limits
+#include <mutex>        // std::mutex, std::lock_guard
+#include <stdexcept>    // std::invalid_argument
+
+namespace hohmann {
+
+namespace {
+
+struct CaseResult {
+    double departureVInfinity;
+    double arrivalVInfinity;
+};
+
+void checkTimesOfFlight(const std::vector<double>& timesOfFlight) {
+    for (double tof : timesOfFlight) {
+        if (!(tof > 0.0)) {
+            throw std::invalid_argument("Porkchop times of flight must be positive");
+        }
+    }
+}
+
+CaseResult evaluateCase(const PlanetEphemeris& departure, const PlanetEphemeris& arrival,
+                        double epoch, double tof) {
+    double arrival_epoch = epoch + tof;
+    auto arc = solveLambert(departure.position(epoch), arrival.position(arrival_epoch),
+                            tof, gm::sun);
+    if (!arc) {
+        double nan = std::numeric_limits<double>::quiet_NaN();
+        return {nan, nan};
+    }
+    return {norm(arc->departureVelocity - departure.velocity(epoch)),
+            norm(arc->arrivalVelocity - arrival.velocity(arrival_epoch))};
+}
+
+double metricValue(const CaseResult& r, PorkchopMetric metric) {
+    switch (metric) {
+        case PorkchopMetric::DepartureVInfinity: return r.departureVInfinity;
+        case PorkchopMetric::ArrivalVInfinity:   return r.arrivalVInfinity;
+        case PorkchopMetric::TotalVInfinity:     break;
+    }
+    return r.departureVInfinity + r.arrivalVInfinity;
+}
+
+} // namespace
+
+void PorkchopColumns::resize(std::size_t count) {
+    departureEpoch.resize(count);
+    timeOfFlight.resize(count);
+    departureVInfinity.resize(count);
+    arrivalVInfinity.resize(count);
+    totalVInfinity.resize(count);
+}
+
+PorkchopColumns computePorkchop(const PlanetEphemeris& departure,
+                                const PlanetEphemeris& arrival,
+                                const std::vector<double>& departureEpochs,
+                                const std::vector<double>& timesOfFlight) {
+    checkTimesOfFlight(timesOfFlight);
+    const std::size_t cols = timesOfFlight.size();
+
+    PorkchopColumns out;
+    out.resize(departureEpochs.size() * cols);
+
+    TaskScheduler::global().parallelFor(0, departureEpochs.size(), 0,
+                                        [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            for (std::size_t j = 0; j < cols; ++j) {
+                std::size_t k = i * cols + j;
+                CaseResult r = evaluateCase(departure, arrival, departureEpochs[i], timesOfFlight[j]);
+                out.departureEpoch[k] = departureEpochs[i];
+                out.timeOfFlight[k] = timesOfFlight[j];
+                out.departureVInfinity[k] = r.departureVInfinity;
+                out.arrivalVInfinity[k] = r.arrivalVInfinity;
+                out.totalVInfinity[k] = r.departureVInfinity + r.arrivalVInfinity;
+            }
+        }
+    });
+    return out;
+}
+
+std::vector<PorkchopCase> porkchopTopK(const PlanetEphemeris& departure,
+                                       const PlanetEphemeris& arrival,
+                                       const std::vector<double>& departureEpochs,
+                                       const std::vector<double>& timesOfFlight,
+                                       std::size_t k, PorkchopMetric metric) {
+    checkTimesOfFlight(timesOfFlight);
+    const std::size_t cols = timesOfFlight.size();
+
+    TopKReducer best(k);
+    std::mutex bestMutex;
+
+    TaskScheduler::global().parallelFor(0, departureEpochs.size(), 0,
+                                        [&](std::size_t first, std::size_t last) {
+        TopKReducer local(k);
+        for (std::size_t i = first; i < last; ++i) {
+            for (std::size_t j = 0; j < cols; ++j) {
+                CaseResult r = evaluateCase(departure, arrival, departureEpochs[i], timesOfFlight[j]);
+                local.offer(metricValue(r, metric), i * cols + j);
+            }
+        }
+        std::lock_guard<std::mutex> lock(bestMutex);
+        best.merge(local);
+    });
+
+    std::vector<PorkchopCase> cases;
+    for (const auto& entry : best.sorted()) {
+        double epoch = departureEpochs[entry.index / cols];
+        double tof = timesOfFlight[entry.index % cols];
+        CaseResult r = evaluateCase(departure, arrival, epoch, tof);
+        cases.push_back({entry.index, epoch, tof, r.departureVInfinity, r.arrivalVInfinity});
+    }
+    return cases;
+}
+
+} // namespace hohmann
@@ -0,0 +1,609 @@
+/*
+ * query_server.cpp - epoll event loop behind hohmannd
+ *
+ * ==============================================================================
+ * WHY A DAEMON?
+ * ==============================================================================
+ *
+ * A tool that shells out to `hohmann` for every query pays process start,
+ * dynamic linking and iostream setup each time - milliseconds for a
+ * computation that takes nanoseconds. A resident server pays those once
+ * and answers over a socket:
+ *
+ *   $ printf 'TRANSFER 6778137 42164137\n' | socat - UNIX-CONNECT:/tmp/hohmannd.sock
+ *   OK 2425.7... 1466.8... 3892.5... 18925.1... 24471137
+ *
+ * BATCHING ACROSS CLIENTS
+ * -----------------------
+ * One epoll_wait() wakeup can report many readable connections, each with
+ * several pipelined lines. Instead of evaluating each TRANSFER as it is
+ * parsed, the loop only records its radii; when every ready connection has
+ * been read, the whole wakeup's transfers go through
+ * calculateTransferBatch() together and the responses are written back in
+ * each connection's request order:
+ *
+ *   wakeup:  conn 3: TRANSFER a   conn 5: TRANSFER c   conn 3: PING
+ *            conn 3: TRANSFER b
+ *                         |
+ *            r1 = [a, b, c]  -> one kernel pass ->  fill responses
+ *                         |
+ *   conn 3 <- OK(a) OK(b) OK PONG          conn 5 <- OK(c)
+ *
+ * The busier the server, the larger the batches, so throughput rises with
+ * load instead of collapsing.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. NON-BLOCKING I/O WITH EPOLL
+ *    - All sockets are O_NONBLOCK; reads and writes run until EAGAIN, and
+ *      EPOLLOUT is only requested while a connection has unsent output
+ *
+ * 2. EVENTFD AS A WAKE-UP CALL
+ *    - stop() writes to an eventfd in the epoll set; write() is
+ *      async-signal-safe, so a SIGINT handler can call it directly
+ *
+ * 3. RAII OVER FILE DESCRIPTORS
+ *    - closeAll() releases every descriptor and the socket file; it runs
+ *      from the destructor and from a constructor that throws half way
+ *
+ * See also:
+ *   hohmannd.cpp for the command-line front end
+ *   transfer_batch.cpp for the kernels the batches feed
+ */
+
+#include "hohmann/query_server.hpp"
+#include "hohmann/constants.hpp"
+
+#include <arpa/inet.h>     // htons, htonl
+#include <netinet/in.h>    // sockaddr_in
+#include <netinet/tcp.h>   // TCP_NODELAY
+#include <sys/epoll.h>     // epoll_create1, epoll_ctl, epoll_wait
+#include <sys/eventfd.h>   // eventfd
+#include <sys/socket.h>    // socket, bind, listen, accept4, recv, send
+#include <sys/stat.h>      // stat, S_ISSOCK
+#include <sys/un.h>        // sockaddr_un
+#include <unistd.h>        // close, read, write, unlink
+
+#include <algorithm>       // std::max, std::min, std::count
+#include <cctype>          // std::toupper, std::isspace
+#include <charconv>        // std::from_chars, std::to_chars
+#include <cerrno>          // errno
+#include <cmath>           // std::isfinite
+#include <chrono>          // std::chrono::steady_clock
+#include <cstdio>          // std::snprintf
+#include <cstring>         // std::memcpy
+#include <sstream>         // std::ostringstream
+#include <stdexcept>       // std::invalid_argument
+#include <system_error>    // std::system_error
+
+namespace hohmann {
+
+namespace {
+
+constexpr int maxEvents = 256;
+constexpr std::size_t readChunk = 64 * 1024;
+
+constexpr const char* commandNames[] = {"transfer", "sweep", "stats", "ping", "quit", "other"};
+
+[[noreturn]] void throwErrno(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+std::int64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void watch(int epoll, int fd, std::uint32_t events) {
+    epoll_event ev{};
+    ev.events = events;
+    ev.data.fd = fd;
+    if (epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &ev) != 0) {
+        throwErrno("epoll_ctl");
+    }
+}
+
+/* Whitespace-separated fields of a line */
+std::vector<std::string> split(const std::string& line) {
+    std::vector<std::string> fields;
+    std::size_t i = 0;
+    while (i < line.size()) {
+        while (i < line.size() && std::isspace(static_cast<unsigned char>(line[i]))) {
+            ++i;
+        }
+        std::size_t j = i;
+        while (j < line.size() && !std::isspace(static_cast<unsigned char>(line[j]))) {
+            ++j;
+        }
+        if (j > i) {
+            fields.push_back(line.substr(i, j - i));
+        }
+        i = j;
+    }
+    return fields;
+}
+
+double parseNumber(const std::string& field) {
+    double value = 0.0;
+    const char* last = field.data() + field.size();
+    const auto [end, error] = std::from_chars(field.data(), last, value);
+    if (error != std::errc() || end != last || !std::isfinite(value)) {
+        throw std::invalid_argument("Bad number '" + field + "'");
+    }
+    return value;
+}
+
+std::size_t parseCount(const std::string& field) {
+    std::size_t value = 0;
+    const char* last = field.data() + field.size();
+    const auto [end, error] = std::from_chars(field.data(), last, value);
+    if (error != std::errc() || end != last) {
+        throw std::invalid_argument("Bad count '" + field + "'");
+    }
+    return value;
+}
+
+/* n evenly spaced values from lo to hi inclusive (just lo when n = 1) */
+std::vector<double> linspace(double lo, double hi, std::size_t n) {
+    std::vector<double> values(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        values[i] = n == 1 ? lo : lo + (hi - lo) * static_cast<double>(i) / static_cast<double>(n - 1);
+    }
+    return values;
+}
+
+/* Append values as space-led fields in the shortest form that reads back exactly */
+void appendFields(std::string& out, std::initializer_list<double> values) {
+    char buffer[32];
+    for (double v : values) {
+        buffer[0] = ' ';
+        const auto result = std::to_chars(buffer + 1, buffer + sizeof(buffer), v);
+        out.append(buffer, result.ptr);
+    }
+}
+
+} // namespace
+
+/*
+ * Connection struct - One client socket and its buffers
+ */
+struct QueryServer::Connection {
+    int fd;
+    std::string in;            // Bytes after the last complete line
+    std::string out;           // Responses not yet accepted by the kernel
+    std::uint32_t watching = EPOLLIN;
+    bool closing = false;      // Close once out drains (QUIT, EOF, overlong line)
+    bool broken = false;       // Close now (socket error)
+    bool touched = false;      // Has output to flush this wakeup
+};
+
+// =============================================================================
+// SETUP AND TEARDOWN
+// =============================================================================
+
+QueryServer::QueryServer(const QueryServerOptions& options) : m_options(options) {
+    if (m_options.socketPath.empty() && m_options.tcpPort < 0) {
+        throw std::invalid_argument("Query server needs a socket path or a TCP port");
+    }
+    if (m_options.tcpPort > 65535) {
+        throw std::invalid_argument("TCP port must be at most 65535");
+    }
+
+    try {
+        m_epoll = epoll_create1(EPOLL_CLOEXEC);
+        if (m_epoll < 0) {
+            throwErrno("epoll_create1");
+        }
+        m_wake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_wake < 0) {
+            throwErrno("eventfd");
+        }
+        watch(m_epoll, m_wake, EPOLLIN);
+
+        if (!m_options.socketPath.empty()) {
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            if (m_options.socketPath.size() >= sizeof(address.sun_path)) {
+                throw std::invalid_argument("Socket path is too long");
+            }
+            std::memcpy(address.sun_path, m_options.socketPath.c_str(), m_options.socketPath.size() + 1);
+
+            struct stat existing {};
+            if (::stat(m_options.socketPath.c_str(), &existing) == 0) {
+                if (!S_ISSOCK(existing.st_mode)) {
+                    throw std::invalid_argument("Socket path names a file that is not a socket");
+                }
+                ::unlink(m_options.socketPath.c_str());
+            }
+
+            m_unixListener = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+            if (m_unixListener < 0) {
+                throwErrno("socket");
+            }
+            if (bind(m_unixListener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+                throwErrno("bind");
+            }
+            m_boundPath = true;
+            if (listen(m_unixListener, SOMAXCONN) != 0) {
+                throwErrno("listen");
+            }
+            watch(m_epoll, m_unixListener, EPOLLIN);
+        }
+
+        if (m_options.tcpPort >= 0) {
+            m_tcpListener = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+            if (m_tcpListener < 0) {
+                throwErrno("socket");
+            }
+            const int one = 1;
+            setsockopt(m_tcpListener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = htons(static_cast<std::uint16_t>(m_options.tcpPort));
+            if (bind(m_tcpListener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+                throwErrno("bind");
+            }
+            if (listen(m_tcpListener, SOMAXCONN) != 0) {
+                throwErrno("listen");
+            }
+            socklen_t length = sizeof(address);
+            if (getsockname(m_tcpListener, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+                throwErrno("getsockname");
+            }
+            m_tcpPort = ntohs(address.sin_port);
+            watch(m_epoll, m_tcpListener, EPOLLIN);
+        }
+    } catch (...) {
+        // The destructor does not run for a half-built object
+        closeAll();
+        throw;
+    }
+}
+
+QueryServer::~QueryServer() {
+    closeAll();
+}
+
+void QueryServer::closeAll() {
+    for (auto& entry : m_connections) {
+        ::close(entry.first);
+    }
+    m_connections.clear();
+    for (int* fd : {&m_unixListener, &m_tcpListener, &m_wake, &m_epoll}) {
+        if (*fd >= 0) {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+    if (m_boundPath) {
+        ::unlink(m_options.socketPath.c_str());
+        m_boundPath = false;
+    }
+}
+
+void QueryServer::stop() {
+    const std::uint64_t one = 1;
+    // Nothing useful to do if this fails; the counter only needs to be non-zero
+    [[maybe_unused]] const ssize_t written = ::write(m_wake, &one, sizeof(one));
+}
+
+// =============================================================================
+// EVENT LOOP
+// =============================================================================
+
+void QueryServer::run() {
+    epoll_event events[maxEvents];
+    bool stopping = false;
+    while (!stopping) {
+        const int ready = epoll_wait(m_epoll, events, maxEvents, -1);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throwErrno("epoll_wait");
+        }
+
+        m_pending.clear();
+        m_groupCount = 0;
+        std::vector<Connection*> touched;
+
+        for (int e = 0; e < ready; ++e) {
+            const int fd = events[e].data.fd;
+            if (fd == m_wake) {
+                std::uint64_t count;
+                [[maybe_unused]] const ssize_t got = ::read(m_wake, &count, sizeof(count));
+                stopping = true;
+                continue;
+            }
+            if (fd == m_unixListener || fd == m_tcpListener) {
+                acceptAll(fd);
+                continue;
+            }
+            const auto it = m_connections.find(fd);
+            if (it == m_connections.end()) {
+                continue;
+            }
+            Connection& connection = *it->second;
+            if (events[e].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                readFrom(connection);
+            }
+            if (events[e].events & EPOLLOUT) {
+                connection.touched = true;
+            }
+            if (connection.touched) {
+                touched.push_back(&connection);
+            }
+        }
+
+        runBatches();
+
+        // Responses in arrival order, which is request order per connection
+        for (Pending& p : m_pending) {
+            Connection& c = *p.connection;
+            if (p.batched) {
+                const BatchGroup& g = m_groups[p.group];
+                c.out += "OK";
+                appendFields(c.out, {g.out.deltaV1[p.slot], g.out.deltaV2[p.slot], g.out.totalDeltaV[p.slot],
+                                     g.out.transferTime[p.slot], g.out.semiMajorAxis[p.slot]});
+                c.out += '\n';
+            } else if (p.command == Stats && p.response.empty()) {
+                const std::string report = statistics();
+                c.out += "OK " + std::to_string(std::count(report.begin(), report.end(), '\n')) + "\n";
+                c.out += report;
+            } else {
+                c.out += p.response;
+            }
+            m_latency[p.command].add(static_cast<double>(now() - p.received) * 1e-3);
+        }
+
+        for (Connection* c : touched) {
+            c->touched = false;
+            flush(*c);
+            if (c->broken || (c->closing && c->out.empty())) {
+                closeConnection(c->fd);
+            }
+        }
+    }
+}
+
+void QueryServer::acceptAll(int listener) {
+    while (true) {
+        const int fd = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;  // EAGAIN, or a client that vanished before we got to it
+        }
+        if (listener == m_tcpListener) {
+            const int one = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        }
+        auto connection = std::make_unique<Connection>();
+        connection->fd = fd;
+        watch(m_epoll, fd, EPOLLIN);
+        m_connections.emplace(fd, std::move(connection));
+    }
+}
+
+void QueryServer::readFrom(Connection& c) {
+    char chunk[readChunk];
+    while (!c.closing && !c.broken && m_pending.size() < m_options.maxBatch) {
+        const ssize_t got = ::recv(c.fd, chunk, sizeof(chunk), 0);
+        if (got < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                c.broken = true;
+            }
+            break;
+        }
+        if (got == 0) {
+            // Peer finished sending; answer what it sent, including a last
+            // line without a newline, then close
+            if (!c.in.empty()) {
+                std::string last;
+                last.swap(c.in);
+                if (last.back() == '\r') {
+                    last.pop_back();
+                }
+                handleLine(c, last, now());
+            }
+            c.closing = true;
+            break;
+        }
+        const std::int64_t received = now();
+        c.in.append(chunk, static_cast<std::size_t>(got));
+
+        std::size_t start = 0;
+        for (std::size_t nl = c.in.find('\n'); nl != std::string::npos; nl = c.in.find('\n', start)) {
+            std::size_t end = nl;
+            if (end > start && c.in[end - 1] == '\r') {
+                --end;
+            }
+            handleLine(c, c.in.substr(start, end - start), received);
+            start = nl + 1;
+            if (c.closing) {
+                break;
+            }
+        }
+        c.in.erase(0, start);
+        if (!c.closing && c.in.size() > m_options.maxLineLength) {
+            m_pending.push_back({&c, Other, received, "ERR line too long\n"});
+            c.in.clear();
+            c.closing = true;
+        }
+    }
+    c.touched = true;
+}
+
+void QueryServer::handleLine(Connection& c, const std::string& line, std::int64_t received) {
+    const std::vector<std::string> fields = split(line);
+    if (fields.empty()) {
+        return;
+    }
+    std::string verb = fields[0];
+    for (char& ch : verb) {
+        ch = static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+    }
+
+    Pending p{&c, Other, received, {}};
+    try {
+        if (verb == "TRANSFER") {
+            p.command = Transfer;
+            if (fields.size() != 3 && fields.size() != 4) {
+                throw std::invalid_argument("usage: TRANSFER r1 r2 [mu]");
+            }
+            const double r1 = parseNumber(fields[1]);
+            const double r2 = parseNumber(fields[2]);
+            const double mu = fields.size() == 4 ? parseNumber(fields[3]) : gm::earth;
+            if (!(r1 > 0.0) || !(r2 > 0.0) || !(mu > 0.0)) {
+                throw std::invalid_argument("Radii and mu must be positive");
+            }
+
+            // Join the group for this mu (almost always the only one)
+            std::size_t g = 0;
+            while (g < m_groupCount && m_groups[g].mu != mu) {
+                ++g;
+            }
+            if (g == m_groupCount) {
+                if (m_groups.size() == m_groupCount) {
+                    m_groups.emplace_back();
+                }
+                m_groups[g].mu = mu;
+                m_groups[g].r1.clear();
+                m_groups[g].r2.clear();
+                ++m_groupCount;
+            }
+            p.batched = true;
+            p.group = g;
+            p.slot = m_groups[g].r1.size();
+            m_groups[g].r1.push_back(r1);
+            m_groups[g].r2.push_back(r2);
+        } else if (verb == "SWEEP") {
+            p.command = Sweep;
+            if (fields.size() < 7 || fields.size() > 9) {
+                throw std::invalid_argument("usage: SWEEP r1min r1max n1 r2min r2max n2 [k] [mu]");
+            }
+            const std::size_t n1 = parseCount(fields[3]);
+            const std::size_t n2 = parseCount(fields[6]);
+            std::size_t k = fields.size() >= 8 ? parseCount(fields[7]) : 10;
+            const double mu = fields.size() == 9 ? parseNumber(fields[8]) : gm::earth;
+            if (n1 == 0 || n2 == 0 || n1 > m_options.maxSweepCells / n2) {
+                throw std::invalid_argument("Sweep grid must have between 1 and "
+                                            + std::to_string(m_options.maxSweepCells) + " cells");
+            }
+            if (k > m_options.maxSweepK) {
+                throw std::invalid_argument("Sweep k must be at most " + std::to_string(m_options.maxSweepK));
+            }
+            k = std::min(k, n1 * n2);  // TopKReducer reserves k slots per chunk
+            if (!(mu > 0.0)) {
+                throw std::invalid_argument("mu must be positive");
+            }
+            const std::vector<double> initial = linspace(parseNumber(fields[1]), parseNumber(fields[2]), n1);
+            const std::vector<double> final = linspace(parseNumber(fields[4]), parseNumber(fields[5]), n2);
+            const std::vector<RankedTransfer> best = sweepTransfersTopK(initial, final, mu, k);
+
+            p.response = "OK " + std::to_string(best.size()) + "\n";
+            for (const RankedTransfer& r : best) {
+                p.response += std::to_string(r.index);
+                appendFields(p.response, {initial[r.index / n2], final[r.index % n2],
+                                          r.result.totalDeltaV, r.result.transferTime});
+                p.response += '\n';
+            }
+        } else if (verb == "STATS") {
+            p.command = Stats;  // Rendered after the batch so it includes this wakeup
+        } else if (verb == "PING") {
+            p.command = Ping;
+            p.response = "OK PONG\n";
+        } else if (verb == "QUIT") {
+            p.command = Quit;
+            p.response = "OK BYE\n";
+            c.closing = true;
+        } else {
+            throw std::invalid_argument("Unknown command '" + fields[0] + "'");
+        }
+    } catch (const std::exception& error) {
+        p.response = std::string("ERR ") + error.what() + "\n";
+    }
+    m_pending.push_back(std::move(p));
+}
+
+void QueryServer::runBatches() {
+    for (std::size_t g = 0; g < m_groupCount; ++g) {
+        BatchGroup& group = m_groups[g];
+        const std::size_t count = group.r1.size();
+        calculateTransferBatch(group.r1.data(), group.r2.data(), count, group.mu, group.out);
+        ++m_batches;
+        m_batchedTransfers += count;
+        m_largestBatch = std::max(m_largestBatch, count);
+    }
+}
+
+void QueryServer::flush(Connection& c) {
+    std::size_t sent = 0;
+    while (sent < c.out.size()) {
+        const ssize_t n = ::send(c.fd, c.out.data() + sent, c.out.size() - sent, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                c.broken = true;
+            }
+            break;
+        }
+        sent += static_cast<std::size_t>(n);
+    }
+    c.out.erase(0, sent);
+
+    // EPOLLOUT only while output is backed up; no EPOLLIN once closing,
+    // or a peer's EOF would wake the loop until the output drains
+    const std::uint32_t events = (c.closing ? 0u : static_cast<std::uint32_t>(EPOLLIN))
+                                 | (c.out.empty() ? 0u : static_cast<std::uint32_t>(EPOLLOUT));
+    if (!c.broken && events != c.watching) {
+        epoll_event ev{};
+        ev.events = events;
+        ev.data.fd = c.fd;
+        epoll_ctl(m_epoll, EPOLL_CTL_MOD, c.fd, &ev);
+        c.watching = events;
+    }
+}
+
+void QueryServer::closeConnection(int fd) {
+    epoll_ctl(m_epoll, EPOLL_CTL_DEL, fd, nullptr);
+    ::close(fd);
+    m_connections.erase(fd);
+}
+
+// =============================================================================
+// STATISTICS
+// =============================================================================
+
+std::string QueryServer::statistics() const {
+    std::ostringstream lines;
+    char buffer[256];
+    for (std::size_t c = 0; c < CommandCount; ++c) {
+        const QuantileSketch& s = m_latency[c];
+        if (s.empty()) {
+            continue;
+        }
+        std::snprintf(buffer, sizeof(buffer), "%s count=%llu p50=%.1f p90=%.1f p99=%.1f max=%.1f\n",
+                      commandNames[c], static_cast<unsigned long long>(s.count()), s.quantile(0.5),
+                      s.quantile(0.9), s.quantile(0.99), s.max());
+        lines << buffer;
+    }
+    std::snprintf(buffer, sizeof(buffer), "batches count=%llu transfers=%llu mean=%.1f largest=%zu\n",
+                  static_cast<unsigned long long>(m_batches), static_cast<unsigned long long>(m_batchedTransfers),
+                  m_batches ? static_cast<double>(m_batchedTransfers) / static_cast<double>(m_batches) : 0.0,
+                  m_largestBatch);
+    lines << buffer;
+    return lines.str();
+}
+
+} // namespace hohmann
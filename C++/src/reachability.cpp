@@ -0,0 +1,211 @@
+/*
+ * reachability.cpp - Inverse Hohmann query
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: The Hohmann Delta-v Curve
+ * ==============================================================================
+ *
+ * Divide everything by the starting circular speed v1 and the starting
+ * radius r1. With x = r2 / r1 the total Hohmann cost depends on x alone:
+ *
+ *   f(x) = | sqrt(2x / (1 + x)) - 1 |  +  | (1 - sqrt(2 / (1 + x))) / sqrt(x) |
+ *
+ *   f / v1
+ *    0.54 |            .-'''-.__
+ *         |          .'          ''--..___          peak at x ~ 15.58
+ *    0.41 |- - - - -/- - - - - - - - - - - - -''--  -> sqrt(2) - 1 as x -> inf
+ *         |        /
+ *       0 +-------*-------------------------------> x = r2 / r1
+ *                 1
+ *
+ * Going down (x < 1), f grows without bound. Going up, f rises to a maximum
+ * and then DECREASES toward the escape cost. So the inverse of f has up to
+ * three roots, and the set of reachable radii can be two disjoint pieces.
+ *
+ * Each root is found with a guarded Newton iteration: Newton's step using
+ * the analytic f'(x), replaced by bisection whenever it would leave the
+ * current bracket. That converges quadratically near the root but can
+ * never diverge.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. FUNCTION-LOCAL STATIC INITIALIZATION
+ *    - The peak ratio is solved once, the first time it is needed; C++11
+ *      guarantees that initialization is thread-safe
+ *
+ * 2. DIMENSIONLESS KERNELS
+ *    - Solving in x and f / v1 means one code path serves every body,
+ *      orbit size and budget; the batch loop only rescales
+ */
+
+#include "hohmann/reachability.hpp"
+#include "hohmann/scheduler.hpp"
+
+#include <algorithm>    // std::max
+#include <cmath>        // std::sqrt, std::abs, std::isinf
+#include <limits>       // std::numeric_limits
+#include <stdexcept>    // std::invalid_argument
+#include <string>       // std::to_string
+
+namespace hohmann {
+
+namespace {
+
+constexpr double infinity = std::numeric_limits<double>::infinity();
+const double escapeCost = std::sqrt(2.0) - 1.0;  // lim f(x), x -> infinity
+
+/* Signed cost: |g(x)| = f(x), negative below x = 1 */
+double signedCost(double x) {
+    double s = std::sqrt(2.0 / (1.0 + x));
+    return std::sqrt(x) * s - 1.0 + (1.0 - s) / std::sqrt(x);
+}
+
+/* d(signedCost)/dx */
+double signedCostSlope(double x) {
+    double s = std::sqrt(2.0 / (1.0 + x));
+    double ds = -s / (2.0 * (1.0 + x));
+    double rx = std::sqrt(x);
+    double x32 = x * rx;
+    return s / (2.0 * rx) + rx * ds - 0.5 / x32 + 0.5 * s / x32 - ds / rx;
+}
+
+double cost(double x) {
+    return std::abs(signedCost(x));
+}
+
+double costSlope(double x) {
+    return x < 1.0 ? -signedCostSlope(x) : signedCostSlope(x);
+}
+
+/**
+ * Guarded Newton for cost(x) = target on a bracket where cost(lo) - target
+ * and cost(hi) - target have opposite signs. Bisection steps use the
+ * geometric mean because the distant root can sit at x ~ 10^6.
+ */
+double solveRatio(double target, double lo, double hi) {
+    double f_lo = cost(lo) - target;
+    double x = std::sqrt(lo * hi);
+    for (int iter = 0; iter < 200; ++iter) {
+        double f = cost(x) - target;
+        if (f == 0.0) {
+            return x;
+        }
+        if ((f < 0.0) == (f_lo < 0.0)) {
+            lo = x;
+            f_lo = f;
+        } else {
+            hi = x;
+        }
+        if (hi - lo <= 1e-14 * hi) {
+            break;
+        }
+        double slope = costSlope(x);
+        double x_newton = slope != 0.0 ? x - f / slope : lo;
+        x = (x_newton > lo && x_newton < hi) ? x_newton : std::sqrt(lo * hi);
+    }
+    return x;
+}
+
+/* x where the upward Hohmann cost peaks (~15.58), via bisection on f' */
+double peakRatio() {
+    static const double peak = [] {
+        double lo = 2.0, hi = 100.0;
+        for (int iter = 0; iter < 200; ++iter) {
+            double mid = 0.5 * (lo + hi);
+            if (signedCostSlope(mid) > 0.0) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        return 0.5 * (lo + hi);
+    }();
+    return peak;
+}
+
+/**
+ * Reachable ratios for a dimensionless budget b = deltaV / v1.
+ */
+ReachableRadii reachableRatios(double b) {
+    if (b == 0.0) {
+        return {1.0, 1.0, infinity};
+    }
+    if (std::isinf(b)) {
+        return {0.0, infinity, infinity};
+    }
+
+    // Downward: f increases without bound as x -> 0
+    double lo = 0.5;
+    while (cost(lo) <= b) {
+        lo *= 0.5;
+    }
+    ReachableRadii ratios{solveRatio(b, lo, 1.0), infinity, infinity};
+
+    // Upward: rises to the peak, then decays toward the escape cost
+    const double x_peak = peakRatio();
+    if (b >= cost(x_peak)) {
+        return ratios;  // Every higher orbit is affordable
+    }
+    ratios.maximumRadius = solveRatio(b, 1.0, x_peak);
+
+    if (b > escapeCost) {
+        double hi = 2.0 * x_peak;
+        while (cost(hi) >= b) {
+            hi *= 2.0;
+        }
+        ratios.distantRadius = solveRatio(b, x_peak, hi);
+    }
+    return ratios;
+}
+
+ReachableRadii scaleRatios(const ReachableRadii& ratios, double r1, double surfaceRadius) {
+    return {std::max(ratios.minimumRadius * r1, surfaceRadius),
+            ratios.maximumRadius * r1,
+            ratios.distantRadius * r1};
+}
+
+} // namespace
+
+ReachableRadii reachableRadii(const Orbit& orbit, double deltaVBudget) {
+    if (!(deltaVBudget >= 0.0)) {
+        throw std::invalid_argument("Delta-v budget must be non-negative");
+    }
+    double v1 = orbit.velocity();
+    return scaleRatios(reachableRatios(deltaVBudget / v1), orbit.radius(),
+                       orbit.body().radius().value_or(0.0));
+}
+
+void ReachabilityColumns::resize(std::size_t count) {
+    minimumRadius.resize(count);
+    maximumRadius.resize(count);
+    distantRadius.resize(count);
+}
+
+void reachableRadiiBatch(const double* radii, const double* budgets, std::size_t count,
+                         double mu, double surfaceRadius, ReachabilityColumns& out) {
+    for (std::size_t k = 0; k < count; ++k) {
+        if (!(radii[k] > 0.0)) {
+            throw std::invalid_argument(
+                "Reachability radius must be positive (spacecraft " + std::to_string(k) + ")");
+        }
+        if (!(budgets[k] >= 0.0)) {
+            throw std::invalid_argument(
+                "Delta-v budget must be non-negative (spacecraft " + std::to_string(k) + ")");
+        }
+    }
+    out.resize(count);
+
+    TaskScheduler::global().parallelFor(0, count, batchGrain, [&](std::size_t first, std::size_t last) {
+        for (std::size_t k = first; k < last; ++k) {
+            double v1 = std::sqrt(mu / radii[k]);
+            ReachableRadii r = scaleRatios(reachableRatios(budgets[k] / v1), radii[k], surfaceRadius);
+            out.minimumRadius[k] = r.minimumRadius;
+            out.maximumRadius[k] = r.maximumRadius;
+            out.distantRadius[k] = r.distantRadius;
+        }
+    });
+}
+
+} // namespace hohmann
@@ -0,0 +1,231 @@
+/*
+ * relative_motion.cpp - Clohessy-Wiltshire relative motion
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Relative Motion Near a Target
+ * ==============================================================================
+ *
+ * A Hohmann transfer and phaseAngle() bring a chaser into the same orbit a
+ * few kilometres from its target. From there on, it is easier to describe
+ * the chaser relative to the target, in the target's rotating Hill frame:
+ *
+ *                 x (radial, up)
+ *                 ^
+ *                 |     * chaser
+ *                 |
+ *   ------------ [T] ------------> y (along-track, direction of motion)
+ *                                  z completes the frame (orbit normal)
+ *
+ * Linearizing gravity about a circular target orbit with mean motion n
+ * gives the Clohessy-Wiltshire (Hill) equations:
+ *
+ *   x'' = 3 n² x + 2 n y'
+ *   y'' =        - 2 n x'
+ *   z'' = - n² z
+ *
+ * They have a closed-form solution, so propagating is a 6x6 matrix multiply
+ * with entries built from c = cos(n t) and s = sin(n t) - no integration.
+ * The counter-intuitive results (burn backwards to move forwards, a radial
+ * offset drifts along-track at 1.5 n x per second) all fall out of it.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. HOISTING INVARIANT WORK
+ *    - The STM and its Phi_rv inverse depend only on (n, dt); they are built
+ *      once per time step and reused for every chaser
+ *
+ * 2. STRUCTURE OF ARRAYS
+ *    - The batch loops read six contiguous columns and write six, so the
+ *      20 multiply-adds per chaser vectorize across chasers
+ *
+ * See also:
+ *   hohmann_transfer.cpp for phaseAngle(), which sets up the approach
+ */
+
+#include "hohmann/relative_motion.hpp"
+#include "hohmann/scheduler.hpp"
+
+#include <algorithm>    // std::max
+#include <cmath>        // std::sin, std::cos, std::sqrt, std::abs
+#include <limits>       // std::numeric_limits
+#include <stdexcept>    // std::invalid_argument
+
+namespace hohmann {
+
+namespace {
+
+// Relative threshold below which a block of Phi_rv is treated as singular
+constexpr double singularTolerance = 1e-10;
+
+} // namespace
+
+CwTransition::CwTransition(double meanMotion, double dt) : m_n(meanMotion), m_dt(dt) {
+    if (!(meanMotion > 0.0)) {
+        throw std::invalid_argument("Mean motion must be positive");
+    }
+    const double n = meanMotion;
+    const double nt = n * dt;
+    const double c = std::cos(nt);
+    const double s = std::sin(nt);
+    m_c = c;
+
+    // Position rows: [Phi_rr | Phi_rv]
+    m_xx = 4.0 - 3.0 * c;
+    m_xvx = s / n;
+    m_xvy = 2.0 * (1.0 - c) / n;
+    m_yx = 6.0 * (s - nt);
+    m_yvx = -2.0 * (1.0 - c) / n;
+    m_yvy = (4.0 * s - 3.0 * nt) / n;
+    m_zvz = s / n;
+
+    // Velocity rows: [Phi_vr | Phi_vv]
+    m_vxx = 3.0 * n * s;
+    m_vxvy = 2.0 * s;
+    m_vyx = -6.0 * n * (1.0 - c);
+    m_vyvx = -2.0 * s;
+    m_vyvy = 4.0 * c - 3.0;
+    m_vzz = -n * s;
+
+    // In-plane Phi_rv: det = (8 (1 - c) - 3 nt s) / n², which vanishes at every
+    // full period and behaves like t² for short times
+    const double detScaled = 8.0 * (1.0 - c) - 3.0 * nt * s;
+    m_inPlaneInvertible = std::abs(detScaled) > singularTolerance * std::max(1.0, nt * nt);
+    m_crossTrackInvertible = std::abs(s) > singularTolerance;
+    if (m_inPlaneInvertible) {
+        const double inv_det = n * n / detScaled;
+        m_inv00 = m_yvy * inv_det;
+        m_inv01 = -m_xvy * inv_det;
+        m_inv10 = -m_yvx * inv_det;
+        m_inv11 = m_xvx * inv_det;
+    } else {
+        m_inv00 = m_inv01 = m_inv10 = m_inv11 = 0.0;
+    }
+}
+
+CwTransition::CwTransition(const Orbit& target, double dt)
+    : CwTransition(target.velocity() / target.radius(), dt) {}
+
+std::optional<Vec3> CwTransition::departureVelocity(const RelativeState& chaser,
+                                                    const Vec3& arrivalPosition) const {
+    if (!m_inPlaneInvertible) {
+        return std::nullopt;
+    }
+    const Vec3& r0 = chaser.position;
+
+    // Position the chaser would reach with zero velocity, subtracted from the goal
+    const double rx = arrivalPosition.x - m_xx * r0.x;
+    const double ry = arrivalPosition.y - (m_yx * r0.x + r0.y);
+    const double rz = arrivalPosition.z - m_c * r0.z;
+
+    Vec3 v{m_inv00 * rx + m_inv01 * ry, m_inv10 * rx + m_inv11 * ry, 0.0};
+    if (m_crossTrackInvertible) {
+        v.z = rz / m_zvz;
+    } else {
+        const double scale = std::max({1.0, std::abs(arrivalPosition.z), std::abs(r0.z)});
+        if (std::abs(rz) > 1e-9 * scale) {
+            return std::nullopt;
+        }
+        v.z = chaser.velocity.z;
+    }
+    return v;
+}
+
+void RelativeColumns::resize(std::size_t count) {
+    x.resize(count);
+    y.resize(count);
+    z.resize(count);
+    vx.resize(count);
+    vy.resize(count);
+    vz.resize(count);
+}
+
+void RelativeColumns::set(std::size_t index, const RelativeState& s) {
+    x[index] = s.position.x;
+    y[index] = s.position.y;
+    z[index] = s.position.z;
+    vx[index] = s.velocity.x;
+    vy[index] = s.velocity.y;
+    vz[index] = s.velocity.z;
+}
+
+void propagateRelativeBatch(const CwTransition& stm, const RelativeColumns& in,
+                            RelativeColumns& out) {
+    const std::size_t count = in.size();
+    out.resize(count);
+    TaskScheduler::global().parallelFor(0, count, batchGrain, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t k = lo; k < hi; ++k) {
+            out.set(k, stm.apply(in.at(k)));
+        }
+    });
+}
+
+RelativeColumns propagateRelativeGrid(double meanMotion, const RelativeColumns& chasers,
+                                      const std::vector<double>& times) {
+    const std::size_t count = chasers.size();
+    std::vector<CwTransition> stms;
+    stms.reserve(times.size());
+    for (double t : times) {
+        stms.emplace_back(meanMotion, t);
+    }
+
+    RelativeColumns out;
+    out.resize(times.size() * count);
+    std::size_t rowGrain = std::max<std::size_t>(1, batchGrain / std::max<std::size_t>(1, count));
+    TaskScheduler::global().parallelFor(0, times.size(), rowGrain, [&](std::size_t first, std::size_t last) {
+        for (std::size_t t = first; t < last; ++t) {
+            const CwTransition& stm = stms[t];
+            const std::size_t row = t * count;
+            for (std::size_t k = 0; k < count; ++k) {
+                out.set(row + k, stm.apply(chasers.at(k)));
+            }
+        }
+    });
+    return out;
+}
+
+std::optional<TwoImpulseManeuver> targetRendezvous(const CwTransition& stm,
+                                                   const RelativeState& chaser,
+                                                   const RelativeState& arrival) {
+    if (!(stm.dt() > 0.0)) {
+        return std::nullopt;
+    }
+    auto departure = stm.departureVelocity(chaser, arrival.position);
+    if (!departure) {
+        return std::nullopt;
+    }
+    RelativeState end = stm.apply({chaser.position, *departure});
+    Vec3 first = *departure - chaser.velocity;
+    Vec3 second = arrival.velocity - end.velocity;
+    return TwoImpulseManeuver{first, second, norm(first) + norm(second)};
+}
+
+void TargetingColumns::resize(std::size_t count) {
+    firstBurn.resize(count);
+    secondBurn.resize(count);
+    totalDeltaV.resize(count);
+}
+
+void targetRendezvousBatch(const CwTransition& stm, const RelativeColumns& chasers,
+                           const RelativeState& arrival, TargetingColumns& out) {
+    const std::size_t count = chasers.size();
+    out.resize(count);
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    TaskScheduler::global().parallelFor(0, count, batchGrain, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t k = lo; k < hi; ++k) {
+            auto maneuver = targetRendezvous(stm, chasers.at(k), arrival);
+            if (maneuver) {
+                out.firstBurn[k] = maneuver->firstBurn;
+                out.secondBurn[k] = maneuver->secondBurn;
+                out.totalDeltaV[k] = maneuver->totalDeltaV;
+            } else {
+                out.firstBurn[k] = {nan, nan, nan};
+                out.secondBurn[k] = {nan, nan, nan};
+                out.totalDeltaV[k] = nan;
+            }
+        }
+    });
+}
+
+} // namespace hohmann
@@ -0,0 +1,201 @@
+/*
+ * station_keeping.cpp - GEO station-keeping delta-v budgets
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Holding a Geostationary Slot
+ * ==============================================================================
+ *
+ * Orbit::GEO() puts a satellite 35,786 km up, where it turns with the
+ * Earth. Left alone it does not stay there: two small perturbations move
+ * it out of its slot (typically a +/-0.05 deg box), and correcting them is
+ * the main propellant cost over a 15-year life.
+ *
+ * NORTH-SOUTH: INCLINATION DRIFT
+ * ------------------------------
+ * The Sun and Moon pull the orbit plane toward their own orbit planes.
+ * Starting from an equatorial orbit the inclination grows by
+ *
+ *   di/dt ~ 0.8457 + 0.0980 cos(Omega_moon)   deg/yr
+ *
+ * Omega_moon, the node of the Moon's orbit on the ecliptic, regresses
+ * once every 18.6 years. When it is near 0 the Moon's orbit is tilted a
+ * full 28.6 deg to the equator and the pull is strongest (~0.94 deg/yr);
+ * near 180 deg it is weakest (~0.75 deg/yr). Removing the inclination
+ * costs v_GEO * di, about 45-50 m/s per year - the dominant term.
+ *
+ * EAST-WEST: LONGITUDE DRIFT
+ * --------------------------
+ * Earth's equator is slightly elliptical (J22), so a GEO satellite sits on
+ * a gentle potential "washboard" with two valleys (stable points) near
+ * 75 E and 255 E:
+ *
+ *   accel
+ *     ^       .--.                  .--.
+ *     |      /    \                /    \
+ *   --+-----*------*------*-------*------*------> longitude
+ *     |  75E \    /  165E  \     / 255E   \
+ *     |       '--'          '---'          '--
+ *
+ *   d²lambda/dt² = -0.00168 sin 2(lambda - 75.07 deg)   deg/day²
+ *
+ * The satellite drifts toward the nearest valley. Cancelling the drift
+ * acceleration with along-track burns costs (a/3) |d²lambda/dt²| per unit
+ * time: up to ~1.7 m/s per year midway between stable and unstable points,
+ * nothing at the stable points themselves.
+ *
+ * Typical budget: 45-50 m/s/yr north-south + 0-2 m/s/yr east-west.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. HOISTING SHARED TERMS
+ *    - The north-south cost depends on the window only, so the batch
+ *      computes it once and broadcasts it to every slot
+ *
+ * 2. CLOSED-FORM AVERAGING
+ *    - The lunar-node term is integrated analytically over the window
+ *      instead of being sampled
+ *
+ * See also:
+ *   orbit.cpp for Orbit::GEO()
+ *   symplectic.cpp for numerically propagating the luni-solar pull
+ */
+
+#include "hohmann/station_keeping.hpp"
+#include "hohmann/scheduler.hpp"
+
+#include <cmath>        // std::sin, std::cos, std::cbrt, std::abs
+#include <iomanip>      // std::setprecision
+#include <iostream>     // std::cout
+#include <stdexcept>    // std::invalid_argument
+
+namespace hohmann {
+
+namespace {
+
+// Luni-solar inclination drift [deg/yr]: base + lunar * cos(Omega_moon)
+constexpr double inclinationDriftBase = 0.8457;
+constexpr double inclinationDriftLunar = 0.0980;
+
+// Moon's ascending node on the ecliptic [deg] and its regression rate [deg/yr]
+constexpr double lunarNodeJ2000 = 125.04452;
+constexpr double lunarNodeRate = -1934.136261 / 100.0;
+
+// Triaxiality longitude acceleration amplitude [deg/day²] and stable point [deg]
+constexpr double longitudeAccelAmplitude = 0.00168;
+constexpr double stableLongitude = 75.07;
+
+/* Geosynchronous radius and circular speed from Earth's GM */
+double geoRadius() {
+    const double n = earthOrientation::rotationRate;
+    return std::cbrt(gm::earth / (n * n));
+}
+
+/* Inclination to remove over [startEpoch, startEpoch + duration] [rad] */
+double inclinationDrift(double startEpoch, double duration) {
+    const double years = duration / timeScale::julianYear;
+    const double rate = lunarNodeRate * math::degToRad;  // [rad/yr]
+    const double node0 = (lunarNodeJ2000 + lunarNodeRate * startEpoch / timeScale::julianYear) * math::degToRad;
+    const double node1 = node0 + rate * years;
+    // integral of cos(node0 + rate * t) dt over [0, years]
+    const double lunar = std::abs(rate * years) > 1e-12 ? (std::sin(node1) - std::sin(node0)) / rate
+                                                        : std::cos(node0) * years;
+    return (inclinationDriftBase * years + inclinationDriftLunar * lunar) * math::degToRad;
+}
+
+/* Signed triaxiality longitude acceleration at the slot [rad/s²] */
+double longitudeAcceleration(double slotLongitude) {
+    const double amplitude = longitudeAccelAmplitude * math::degToRad / (timeScale::day * timeScale::day);
+    return -amplitude * std::sin(2.0 * (slotLongitude - stableLongitude * math::degToRad));
+}
+
+void validateDuration(double duration) {
+    if (!(duration >= 0.0)) {
+        throw std::invalid_argument("Station-keeping window must not be negative");
+    }
+}
+
+} // namespace
+
+StationKeepingBudget stationKeepingBudget(double slotLongitude, double startEpoch, double duration) {
+    validateDuration(duration);
+    const double a = geoRadius();
+    const double v = std::sqrt(gm::earth / a);
+    const double inclination = inclinationDrift(startEpoch, duration);
+
+    StationKeepingBudget budget;
+    budget.duration = duration;
+    budget.inclinationDrift = duration > 0.0 ? inclination / duration : 0.0;
+    budget.longitudeAcceleration = longitudeAcceleration(slotLongitude);
+    budget.northSouthDeltaV = v * inclination;
+    budget.eastWestDeltaV = a / 3.0 * std::abs(budget.longitudeAcceleration) * duration;
+    budget.totalDeltaV = budget.northSouthDeltaV + budget.eastWestDeltaV;
+    return budget;
+}
+
+void StationKeepingColumns::resize(std::size_t count) {
+    northSouthDeltaV.resize(count);
+    eastWestDeltaV.resize(count);
+    totalDeltaV.resize(count);
+}
+
+void stationKeepingBatch(const double* slotLongitudes, std::size_t count, double startEpoch,
+                         double duration, StationKeepingColumns& out, const CancellationToken* token) {
+    validateDuration(duration);
+    const double a = geoRadius();
+    const double northSouth = std::sqrt(gm::earth / a) * inclinationDrift(startEpoch, duration);
+    const double eastWestScale = a / 3.0 * duration;
+
+    out.resize(count);
+    TaskScheduler::global().parallelFor(0, count, batchGrain, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t k = lo; k < hi; ++k) {
+            const double eastWest = eastWestScale * std::abs(longitudeAcceleration(slotLongitudes[k]));
+            out.northSouthDeltaV[k] = northSouth;
+            out.eastWestDeltaV[k] = eastWest;
+            out.totalDeltaV[k] = northSouth + eastWest;
+        }
+    }, token);
+}
+
+FleetStationKeepingSummary summarizeStationKeeping(const StationKeepingColumns& budgets, double duration) {
+    FleetStationKeepingSummary summary;
+    summary.satellites = budgets.size();
+    summary.duration = duration;
+    for (std::size_t k = 0; k < budgets.size(); ++k) {
+        summary.northSouthDeltaV += budgets.northSouthDeltaV[k];
+        summary.eastWestDeltaV += budgets.eastWestDeltaV[k];
+        summary.totalDeltaV += budgets.totalDeltaV[k];
+        if (budgets.totalDeltaV[k] > summary.maxTotalDeltaV) {
+            summary.maxTotalDeltaV = budgets.totalDeltaV[k];
+            summary.maxIndex = k;
+        }
+    }
+    return summary;
+}
+
+void FleetStationKeepingSummary::printSummary() const {
+    const double n = satellites > 0 ? static_cast<double>(satellites) : 1.0;
+    const double years = duration / timeScale::julianYear;
+    const double perYear = years > 0.0 ? 1.0 / years : 0.0;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n========================================\n";
+    std::cout << "   GEO Station-Keeping Budget Summary\n";
+    std::cout << "========================================\n\n";
+    std::cout << "Satellites: " << satellites << "\n";
+    std::cout << "Window:     " << years << " years\n\n";
+
+    std::cout << "                 Fleet total   Per sat   Per sat-year\n";
+    std::cout << "  North-south: " << std::setw(11) << northSouthDeltaV << std::setw(10)
+              << northSouthDeltaV / n << std::setw(15) << northSouthDeltaV / n * perYear << " m/s\n";
+    std::cout << "  East-west:   " << std::setw(11) << eastWestDeltaV << std::setw(10)
+              << eastWestDeltaV / n << std::setw(15) << eastWestDeltaV / n * perYear << " m/s\n";
+    std::cout << "  Total:       " << std::setw(11) << totalDeltaV << std::setw(10)
+              << totalDeltaV / n << std::setw(15) << totalDeltaV / n * perYear << " m/s\n\n";
+
+    std::cout << "Most expensive slot: #" << maxIndex << " (" << maxTotalDeltaV << " m/s)\n";
+    std::cout << "\n========================================\n";
+}
+
+} // namespace hohmann
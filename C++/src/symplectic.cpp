@@ -0,0 +1,319 @@
+/*
+ * symplectic.cpp - Symplectic integrators for long-duration propagation
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Why Symplectic?
+ * ==============================================================================
+ *
+ * An adaptive Runge-Kutta integrator makes a small error every step, and
+ * those errors have a bias: the orbit's energy slowly drifts, so over
+ * decades a GEO satellite spirals in or out for purely numerical reasons.
+ *
+ * A SYMPLECTIC integrator splits the motion into pieces that can each be
+ * solved exactly - "drift" (move at constant velocity) and "kick" (change
+ * velocity by the force at a fixed position) - and alternates them:
+ *
+ *   leapfrog:  drift h/2 -> kick h -> drift h/2
+ *
+ * Each piece preserves phase-space volume, so the composite does too. The
+ * result exactly solves a slightly perturbed problem, which means the
+ * energy error OSCILLATES but never grows:
+ *
+ *   |dE|   RK45 ......./          symplectic ~~~~~~~~~~~~~~~~~~
+ *          ....../
+ *          ___________________________ t
+ *
+ * Chaining leapfrogs with Yoshida's magic step weights (some negative!)
+ * raises the order to 4 or 6. Wisdom-Holman instead drifts along the exact
+ * KEPLER orbit (solved with universal variables) and only kicks with the
+ * small perturbations, so a step of hours still tracks a LEO orbit.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. CACHE BLOCKING
+ *    - A chunk of members is copied into fixed-size local arrays and run
+ *      through ALL steps before the next chunk, so the working set lives
+ *      in L1 instead of streaming the whole ensemble every step
+ *
+ * 2. VECTORIZABLE KERNELS
+ *    - Kick and drift are branch-free loops over contiguous columns; the
+ *      only conditionals test loop-invariant model flags
+ *
+ * 3. OPERATOR COMPOSITION AS DATA
+ *    - Every scheme is a table of drift / kick coefficients; adjacent
+ *      drifts (also across steps) are fused before they are applied
+ *
+ * See also:
+ *   stumpff.hpp for the universal-variable functions of the Kepler drift
+ *   propagator.hpp for GravityModel and the adaptive (RK45) alternative
+ */
+
+#include "hohmann/symplectic.hpp"
+#include "hohmann/constants.hpp"
+#include "hohmann/stumpff.hpp"
+
+#include <algorithm>    // std::min, std::max
+#include <array>        // std::array
+#include <cmath>        // std::sqrt, std::cos, std::sin, std::abs, std::cbrt
+#include <stdexcept>    // std::invalid_argument
+
+namespace hohmann {
+
+namespace {
+
+constexpr std::size_t chunkSize = 256;
+
+/**
+ * Scheme as alternating coefficients: drift[0] kick[0] drift[1] ... kick[m-1]
+ * drift[m], in units of the step
+ */
+struct Composition {
+    std::vector<double> drift;
+    std::vector<double> kick;
+};
+
+Composition composition(SymplecticScheme scheme) {
+    std::vector<double> weights;
+    switch (scheme) {
+        case SymplecticScheme::Leapfrog:
+        case SymplecticScheme::WisdomHolman:
+            weights = {1.0};
+            break;
+        case SymplecticScheme::Yoshida4: {
+            const double w1 = 1.0 / (2.0 - std::cbrt(2.0));
+            const double w0 = 1.0 - 2.0 * w1;
+            weights = {w1, w0, w1};
+            break;
+        }
+        case SymplecticScheme::Yoshida6: {
+            // Yoshida (1990), solution A
+            const double w1 = -1.17767998417887;
+            const double w2 = 0.235573213359357;
+            const double w3 = 0.784513610477560;
+            const double w0 = 1.0 - 2.0 * (w1 + w2 + w3);
+            weights = {w3, w2, w1, w0, w1, w2, w3};
+            break;
+        }
+    }
+    Composition c;
+    c.drift.push_back(weights.front() / 2.0);
+    for (std::size_t k = 0; k < weights.size(); ++k) {
+        c.kick.push_back(weights[k]);
+        double next = k + 1 < weights.size() ? weights[k + 1] : 0.0;
+        c.drift.push_back((weights[k] + next) / 2.0);
+    }
+    return c;
+}
+
+struct Chunk {
+    std::size_t count = 0;
+    std::array<double, chunkSize> x, y, z, vx, vy, vz;
+};
+
+/**
+ * Exact two-body motion over dt (any sign) by universal variables
+ */
+void keplerDrift(double mu, double& x, double& y, double& z, double& vx, double& vy, double& vz, double dt) {
+    const double sqrtMu = std::sqrt(mu);
+    const double r0 = std::sqrt(x * x + y * y + z * z);
+    const double v2 = vx * vx + vy * vy + vz * vz;
+    const double rv = x * vx + y * vy + z * vz;
+    const double alpha = 2.0 / r0 - v2 / mu;   // 1 / a
+
+    // Newton on Kepler's universal equation F(chi) = 0
+    double chi = sqrtMu * dt / r0;
+    double c = 0.5, s = 1.0 / 6.0;
+    for (int iter = 0; iter < 50; ++iter) {
+        const double chi2 = chi * chi;
+        const double zeta = alpha * chi2;
+        c = stumpffC(zeta);
+        s = stumpffS(zeta);
+        const double f = rv / sqrtMu * chi2 * c + (1.0 - alpha * r0) * chi2 * chi * s + r0 * chi - sqrtMu * dt;
+        const double df = rv / sqrtMu * chi * (1.0 - zeta * s) + (1.0 - alpha * r0) * chi2 * c + r0;
+        const double delta = f / df;
+        chi -= delta;
+        if (std::abs(delta) <= 1e-15 * std::max(1.0, std::abs(chi))) {
+            const double zNew = alpha * chi * chi;
+            c = stumpffC(zNew);
+            s = stumpffS(zNew);
+            break;
+        }
+    }
+
+    const double chi2 = chi * chi;
+    const double f = 1.0 - chi2 / r0 * c;
+    const double g = dt - chi2 * chi * s / sqrtMu;
+    const double nx = f * x + g * vx, ny = f * y + g * vy, nz = f * z + g * vz;
+    const double r = std::sqrt(nx * nx + ny * ny + nz * nz);
+    const double fdot = sqrtMu / (r * r0) * (alpha * chi2 * chi * s - chi);
+    const double gdot = 1.0 - chi2 / r * c;
+    const double nvx = fdot * x + gdot * vx, nvy = fdot * y + gdot * vy, nvz = fdot * z + gdot * vz;
+    x = nx;
+    y = ny;
+    z = nz;
+    vx = nvx;
+    vy = nvy;
+    vz = nvz;
+}
+
+void drift(Chunk& c, bool kepler, double mu, double dt) {
+    if (kepler) {
+        for (std::size_t i = 0; i < c.count; ++i) {
+            keplerDrift(mu, c.x[i], c.y[i], c.z[i], c.vx[i], c.vy[i], c.vz[i], dt);
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < c.count; ++i) {
+        c.x[i] += dt * c.vx[i];
+        c.y[i] += dt * c.vy[i];
+        c.z[i] += dt * c.vz[i];
+    }
+}
+
+/**
+ * Velocity kick by the model's acceleration at time t; the central point
+ * mass is left out for Wisdom-Holman (its drift already contains it)
+ */
+void kick(Chunk& c, const SymplecticModel& model, bool pointMass, double t, double h) {
+    const GravityModel& g = model.central;
+    const double mu = pointMass ? g.mu : 0.0;
+    const bool j2 = g.j2 != 0.0;
+    const double j2Factor = 1.5 * g.j2 * g.mu * g.equatorialRadius * g.equatorialRadius;
+    for (std::size_t i = 0; i < c.count; ++i) {
+        const double r2 = c.x[i] * c.x[i] + c.y[i] * c.y[i] + c.z[i] * c.z[i];
+        const double invR = 1.0 / std::sqrt(r2);
+        const double invR3 = invR * invR * invR;
+        double kxy = -mu * invR3, kz = kxy;
+        if (j2) {
+            const double invR5 = invR3 * invR * invR;
+            const double z2 = 5.0 * c.z[i] * c.z[i] * invR * invR;
+            kxy -= j2Factor * invR5 * (1.0 - z2);
+            kz -= j2Factor * invR5 * (3.0 - z2);
+        }
+        c.vx[i] += h * kxy * c.x[i];
+        c.vy[i] += h * kxy * c.y[i];
+        c.vz[i] += h * kz * c.z[i];
+    }
+    for (const ThirdBody& body : model.thirdBodies) {
+        const Vec3 s = body.position(t);
+        const double sNorm = norm(s);
+        const double indirect = body.gm / (sNorm * sNorm * sNorm);
+        for (std::size_t i = 0; i < c.count; ++i) {
+            const double dx = s.x - c.x[i], dy = s.y - c.y[i], dz = s.z - c.z[i];
+            const double d2 = dx * dx + dy * dy + dz * dz;
+            const double k = body.gm / (d2 * std::sqrt(d2));
+            c.vx[i] += h * (k * dx - indirect * s.x);
+            c.vy[i] += h * (k * dy - indirect * s.y);
+            c.vz[i] += h * (k * dz - indirect * s.z);
+        }
+    }
+}
+
+} // namespace
+
+Vec3 ThirdBody::position(double t) const {
+    const double u = phase + meanMotion * t;
+    const double cu = std::cos(u), su = std::sin(u);
+    const double co = std::cos(raan), so = std::sin(raan);
+    const double ci = std::cos(inclination), si = std::sin(inclination);
+    return {radius * (cu * co - su * ci * so), radius * (cu * so + su * ci * co), radius * su * si};
+}
+
+ThirdBody ThirdBody::Sun() {
+    const double r = orbitalRadius::earth;
+    // Geocentric Sun longitude = heliocentric Earth longitude + 180 deg
+    return {gm::sun, r, earthOrientation::obliquityJ2000 * math::degToRad, 0.0,
+            std::sqrt((gm::sun + gm::earth) / (r * r * r)),
+            (meanLongitudeJ2000::earth + 180.0) * math::degToRad};
+}
+
+ThirdBody ThirdBody::Moon() {
+    const double r = orbitalRadius::moon;
+    return {gm::moon, r, earthOrientation::obliquityJ2000 * math::degToRad, 0.0,
+            std::sqrt((gm::earth + gm::moon) / (r * r * r)), meanLongitudeJ2000::moon * math::degToRad};
+}
+
+bool propagateSymplectic(const SymplecticModel& model, SymplecticScheme scheme, StateVectorArray& states,
+                         double startTime, double dt, std::size_t steps, const CancellationToken* token) {
+    if (!(dt > 0.0)) {
+        throw std::invalid_argument("Time step must be positive");
+    }
+    const Composition comp = composition(scheme);
+    const bool kepler = scheme == SymplecticScheme::WisdomHolman;
+    const std::size_t count = states.size();
+
+    TaskScheduler::global().parallelFor(0, count, chunkSize, [&](std::size_t first, std::size_t last) {
+        for (std::size_t lo = first; lo < last; lo += chunkSize) {
+            if (token && token->cancelled()) {
+                return;
+            }
+            Chunk c;
+            c.count = std::min(chunkSize, last - lo);
+            for (std::size_t i = 0; i < c.count; ++i) {
+                c.x[i] = states.x[lo + i];
+                c.y[i] = states.y[lo + i];
+                c.z[i] = states.z[lo + i];
+                c.vx[i] = states.vx[lo + i];
+                c.vy[i] = states.vy[lo + i];
+                c.vz[i] = states.vz[lo + i];
+            }
+
+            // Drifts advance time; consecutive drifts are fused
+            double t = startTime;
+            double pending = 0.0;
+            for (std::size_t step = 0; step < steps; ++step) {
+                for (std::size_t k = 0; k < comp.kick.size(); ++k) {
+                    pending += comp.drift[k] * dt;
+                    drift(c, kepler, model.central.mu, pending);
+                    t += pending;
+                    pending = 0.0;
+                    kick(c, model, !kepler, t, comp.kick[k] * dt);
+                }
+                pending += comp.drift.back() * dt;
+            }
+            if (pending != 0.0) {
+                drift(c, kepler, model.central.mu, pending);
+            }
+
+            for (std::size_t i = 0; i < c.count; ++i) {
+                states.x[lo + i] = c.x[i];
+                states.y[lo + i] = c.y[i];
+                states.z[lo + i] = c.z[i];
+                states.vx[lo + i] = c.vx[i];
+                states.vy[lo + i] = c.vy[i];
+                states.vz[lo + i] = c.vz[i];
+            }
+        }
+    }, token);
+    return !(token && token->cancelled());
+}
+
+void specificEnergy(const SymplecticModel& model, const StateVectorArray& states, double time,
+                    std::vector<double>& energy) {
+    const GravityModel& g = model.central;
+    const std::size_t count = states.size();
+    energy.resize(count);
+    std::vector<Vec3> bodies;
+    for (const ThirdBody& body : model.thirdBodies) {
+        bodies.push_back(body.position(time));
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        const double x = states.x[i], y = states.y[i], z = states.z[i];
+        const double r2 = x * x + y * y + z * z;
+        const double r = std::sqrt(r2);
+        double e = 0.5 * (states.vx[i] * states.vx[i] + states.vy[i] * states.vy[i]
+                          + states.vz[i] * states.vz[i]) - g.mu / r;
+        e += 0.5 * g.mu * g.j2 * g.equatorialRadius * g.equatorialRadius / (r2 * r) * (3.0 * z * z / r2 - 1.0);
+        for (std::size_t b = 0; b < bodies.size(); ++b) {
+            const Vec3& s = bodies[b];
+            const double sNorm = norm(s);
+            const double d = norm(s - Vec3{x, y, z});
+            e -= model.thirdBodies[b].gm * (1.0 / d - (x * s.x + y * s.y + z * s.z) / (sNorm * sNorm * sNorm));
+        }
+        energy[i] = e;
+    }
+}
+
+} // namespace hohmann
@@ -0,0 +1,52 @@
+/*
+ * top_k.cpp - Streaming top-k reducer
+ *
+ * ==============================================================================
+ * WHY A BOUNDED HEAP?
+ * ==============================================================================
+ *
+ * A 10,000 x 10,000 sweep is 10^8 cases. Storing every TransferResult to
+ * pick the 20 cheapest costs gigabytes; keeping only the 20 best seen so far
+ * costs a few hundred bytes. A max-heap of size k puts the current worst
+ * kept case at the root:
+ *
+ *   new case worse than the root?  -> reject (the common case, 1 compare)
+ *   new case better?               -> replace the root, sift down (log k)
+ *
+ * Each thread fills its own heap; the heaps are merged once at the end.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. <algorithm> HEAP OPERATIONS
+ *    - std::push_heap / std::pop_heap / std::sort_heap turn a plain
+ *      std::vector into a priority queue we can also iterate and copy
+ */
+
+#include "hohmann/top_k.hpp"
+
+#include <limits>       // std::numeric_limits
+
+namespace hohmann {
+
+void TopKReducer::merge(const TopKReducer& other) {
+    for (const auto& entry : other.m_heap) {
+        offer(entry.value, entry.index);
+    }
+}
+
+std::vector<RankedIndex> TopKReducer::sorted() const {
+    std::vector<RankedIndex> result = m_heap;
+    std::sort_heap(result.begin(), result.end(), ranksBefore);
+    return result;
+}
+
+double TopKReducer::threshold() const {
+    if (m_heap.size() < m_k || m_heap.empty()) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return m_heap.front().value;
+}
+
+} // namespace hohmann
@@ -0,0 +1,360 @@
+/*
+ * transfer_batch.cpp - Batch and sweep evaluation of Hohmann-style transfers
+ *
+ * ==============================================================================
+ * AEROSPACE CONCEPT: Transfers Between Elliptical Orbits
+ * ==============================================================================
+ *
+ * The classic Hohmann transfer assumes both orbits are circles. Real missions
+ * often start or end on ellipses:
+ *
+ *   - GTO -> GEO: the launcher drops the satellite on a 250 x 35,786 km ellipse
+ *   - Molniya: 12-hour, e ~ 0.74 orbits used for high-latitude coverage
+ *
+ * If the two ellipses are coplanar and share an apse line (coaxial), the
+ * cheapest two-burn transfer is still a half-ellipse tangent to both orbits,
+ * but there are now two candidates because periapsis and apoapsis differ:
+ *
+ *            final apoapsis                       final periapsis
+ *                 *                                     *
+ *               /   \   <- transfer                  /     \
+ *              |  F  |                              |   F   |
+ *               \   /                                \     /
+ *                 *                                     *
+ *        initial periapsis                    initial apoapsis
+ *
+ *     PeriapsisToApoapsis               ApoapsisToPeriapsis
+ *
+ * Both are evaluated with the vis-viva equation and the cheaper one wins.
+ * Burning where the spacecraft is fastest (periapsis) usually wins -
+ * the Oberth effect - but not always, so we check rather than assume.
+ *
+ * ==============================================================================
+ * C++ CONCEPTS DEMONSTRATED IN THIS FILE
+ * ==============================================================================
+ *
+ * 1. FUNCTION OVERLOADING
+ *    - Two calculateTransferBatch() signatures: circular and eccentric.
+ *      The compiler picks one from the argument list.
+ *
+ * 2. RAW POINTER INPUTS
+ *    - Taking `const double*` + count lets callers pass std::vector::data(),
+ *      a std::array, or a slice of a bigger buffer without copying
+ *
+ * 3. INLINE KERNELS FROM A HEADER
+ *    - tangentTransfer()/coaxialTransfer() are defined in transfer_kernel.hpp,
+ *      so each loop below compiles to straight-line math with no calls
+ *
+ * 4. PARALLEL CHUNKS ON THE SHARED SCHEDULER
+ *    - Each chunk writes a disjoint slice of the output columns, so chunks
+ *      run on TaskScheduler::global() with no locking; small batches stay
+ *      on the calling thread
+ *
+ * See also:
+ *   transfer_kernel.hpp for the per-case math
+ *   hohmann_transfer.hpp for the single-transfer class
+ *   scheduler.hpp for parallelFor
+ */
+
+#include "hohmann/transfer_batch.hpp"
+#include "hohmann/scheduler.hpp"
+
+#include <algorithm>    // std::max
+#include <mutex>        // std::mutex, std::lock_guard
+#include <stdexcept>    // std::invalid_argument
+#include <string>       // std::to_string
+
+namespace hohmann {
+
+namespace {
+
+/**
+ * Reject bad inputs before the hot loop so the kernel never produces NaN.
+ */
+void validateColumns(const double* r1, const double* r2, const double* e1,
+                     const double* e2, std::size_t count) {
+    for (std::size_t k = 0; k < count; ++k) {
+        if (!(r1[k] > 0.0) || !(r2[k] > 0.0)) {
+            throw std::invalid_argument(
+                "Transfer batch radius must be positive (case " + std::to_string(k) + ")");
+        }
+        if (e1 && e2 && (!(e1[k] >= 0.0 && e1[k] < 1.0) || !(e2[k] >= 0.0 && e2[k] < 1.0))) {
+            throw std::invalid_argument(
+                "Transfer batch eccentricity must be in [0, 1) (case " + std::to_string(k) + ")");
+        }
+    }
+}
+
+/**
+ * Validate sweep axes; returns true when eccentricity columns are present.
+ */
+bool checkSweepAxes(const std::vector<double>& initialRadii,
+                    const std::vector<double>& finalRadii,
+                    const std::vector<double>& initialEccentricities,
+                    const std::vector<double>& finalEccentricities) {
+    bool eccentric = !initialEccentricities.empty() || !finalEccentricities.empty();
+    if (eccentric && (initialEccentricities.size() != initialRadii.size() ||
+                      finalEccentricities.size() != finalRadii.size())) {
+        throw std::invalid_argument(
+            "Sweep eccentricity columns must match their radius axes");
+    }
+    return eccentric;
+}
+
+/* Pick the ranked column out of one kernel result */
+inline double metricValue(const TransferResult& r, TransferMetric metric) {
+    switch (metric) {
+        case TransferMetric::DeltaV1:      return r.deltaV1;
+        case TransferMetric::DeltaV2:      return r.deltaV2;
+        case TransferMetric::TransferTime: return r.transferTime;
+        case TransferMetric::TotalDeltaV:  break;
+    }
+    return r.totalDeltaV;
+}
+
+/* Store one kernel result into column slot k */
+inline void store(TransferColumns& out, std::size_t k, const TransferResult& r,
+                  TangentOption option) {
+    out.deltaV1[k] = r.deltaV1;
+    out.deltaV2[k] = r.deltaV2;
+    out.totalDeltaV[k] = r.totalDeltaV;
+    out.transferTime[k] = r.transferTime;
+    out.semiMajorAxis[k] = r.semiMajorAxis;
+    out.option[k] = option;
+}
+
+} // namespace
+
+// =============================================================================
+// TRANSFER COLUMNS
+// =============================================================================
+
+void TransferColumns::resize(std::size_t count) {
+    deltaV1.resize(count);
+    deltaV2.resize(count);
+    totalDeltaV.resize(count);
+    transferTime.resize(count);
+    semiMajorAxis.resize(count);
+    option.resize(count);
+}
+
+TransferResult TransferColumns::at(std::size_t index) const {
+    return {deltaV1[index], deltaV2[index], totalDeltaV[index],
+            transferTime[index], semiMajorAxis[index]};
+}
+
+// =============================================================================
+// BATCH EVALUATION
+// =============================================================================
+
+/**
+ * Circular endpoints: for a circle the orbit's semi-major axis IS its
+ * radius, so we call the tangent kernel directly and skip the comparison.
+ */
+void calculateTransferBatch(const double* r1, const double* r2, std::size_t count,
+                            double mu, TransferColumns& out) {
+    validateColumns(r1, r2, nullptr, nullptr, count);
+    out.resize(count);
+
+    TaskScheduler::global().parallelFor(0, count, batchGrain, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t k = lo; k < hi; ++k) {
+            store(out, k, tangentTransfer(r1[k], r1[k], r2[k], r2[k], mu),
+                  TangentOption::PeriapsisToApoapsis);
+        }
+    });
+}
+
+/**
+ * Coaxial elliptic endpoints: both tangent variants per case.
+ */
+void calculateTransferBatch(const double* r1, const double* r2,
+                            const double* e1, const double* e2, std::size_t count,
+                            double mu, TransferColumns& out) {
+    validateColumns(r1, r2, e1, e2, count);
+    out.resize(count);
+
+    TaskScheduler::global().parallelFor(0, count, batchGrain, [&](std::size_t lo, std::size_t hi) {
+        TransferResult result;
+        for (std::size_t k = lo; k < hi; ++k) {
+            TangentOption option = coaxialTransfer(r1[k], e1[k], r2[k], e2[k], mu, result);
+            store(out, k, result, option);
+        }
+    });
+}
+
+// =============================================================================
+// GRADIENT BATCH
+// =============================================================================
+
+void TransferGradientColumns::resize(std::size_t count) {
+    totalDeltaV.resize(count);
+    transferTime.resize(count);
+    deltaVByR1.resize(count);
+    deltaVByR2.resize(count);
+    deltaVByMu.resize(count);
+    timeByR1.resize(count);
+    timeByR2.resize(count);
+    timeByMu.resize(count);
+}
+
+/**
+ * Circular endpoints with derivatives: full lane packs through the
+ * vectorized dual kernel, then the remainder one case at a time.
+ */
+void calculateTransferGradientBatch(const double* r1, const double* r2, std::size_t count,
+                                    double mu, TransferGradientColumns& out) {
+    validateColumns(r1, r2, nullptr, nullptr, count);
+    out.resize(count);
+
+    constexpr std::size_t width = 4;
+    using Pack = Lanes<width>;
+    using D = Dual<3, Pack>;
+    const std::size_t packs = count / width;
+
+    auto storeGradient = [&out](std::size_t k, const TransferGradient& g) {
+        out.totalDeltaV[k] = g.result.totalDeltaV;
+        out.transferTime[k] = g.result.transferTime;
+        out.deltaVByR1[k] = g.totalDeltaV[0];
+        out.deltaVByR2[k] = g.totalDeltaV[1];
+        out.deltaVByMu[k] = g.totalDeltaV[2];
+        out.timeByR1[k] = g.transferTime[0];
+        out.timeByR2[k] = g.transferTime[1];
+        out.timeByMu[k] = g.transferTime[2];
+    };
+
+    TaskScheduler::global().parallelFor(0, packs, batchGrain / width, [&](std::size_t lo, std::size_t hi) {
+        const D gm = D::variable(Pack::broadcast(mu), 2);
+        for (std::size_t p = lo; p < hi; ++p) {
+            const std::size_t k = p * width;
+            const D radius1 = D::variable(Pack::load(r1 + k), 0);
+            const D radius2 = D::variable(Pack::load(r2 + k), 1);
+            const BasicTransferResult<D> d = tangentTransfer(radius1, radius1, radius2, radius2, gm);
+
+            d.totalDeltaV.value.store(&out.totalDeltaV[k]);
+            d.transferTime.value.store(&out.transferTime[k]);
+            d.totalDeltaV.grad[0].store(&out.deltaVByR1[k]);
+            d.totalDeltaV.grad[1].store(&out.deltaVByR2[k]);
+            d.totalDeltaV.grad[2].store(&out.deltaVByMu[k]);
+            d.transferTime.grad[0].store(&out.timeByR1[k]);
+            d.transferTime.grad[1].store(&out.timeByR2[k]);
+            d.transferTime.grad[2].store(&out.timeByMu[k]);
+        }
+    });
+    for (std::size_t k = packs * width; k < count; ++k) {
+        storeGradient(k, transferGradient(r1[k], r2[k], mu));
+    }
+}
+
+// =============================================================================
+// GRID SWEEP
+// =============================================================================
+
+/**
+ * Expand the two axes into flat input columns, then run one batch call.
+ *
+ * PERFORMANCE NOTE:
+ * -----------------
+ * Materializing the grid costs 2-4 doubles per case but turns the sweep into
+ * a single unit-stride loop, which is far friendlier to the CPU than nested
+ * loops calling a per-pair function.
+ */
+TransferColumns sweepTransfers(const std::vector<double>& initialRadii,
+                               const std::vector<double>& finalRadii,
+                               double mu,
+                               const std::vector<double>& initialEccentricities,
+                               const std::vector<double>& finalEccentricities) {
+    bool eccentric = checkSweepAxes(initialRadii, finalRadii,
+                                    initialEccentricities, finalEccentricities);
+
+    const std::size_t rows = initialRadii.size();
+    const std::size_t cols = finalRadii.size();
+    const std::size_t count = rows * cols;
+
+    std::vector<double> r1(count), r2(count);
+    std::vector<double> e1(eccentric ? count : 0), e2(eccentric ? count : 0);
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            std::size_t k = i * cols + j;
+            r1[k] = initialRadii[i];
+            r2[k] = finalRadii[j];
+            if (eccentric) {
+                e1[k] = initialEccentricities[i];
+                e2[k] = finalEccentricities[j];
+            }
+        }
+    }
+
+    TransferColumns out;
+    if (eccentric) {
+        calculateTransferBatch(r1.data(), r2.data(), e1.data(), e2.data(), count, mu, out);
+    } else {
+        calculateTransferBatch(r1.data(), r2.data(), count, mu, out);
+    }
+    return out;
+}
+
+// =============================================================================
+// TOP-K SWEEP
+// =============================================================================
+
+/**
+ * Same grid as sweepTransfers(), but each case is offered to a chunk-local
+ * TopKReducer and then dropped. Only the k winners are re-evaluated at the
+ * end to return their full results.
+ */
+std::vector<RankedTransfer> sweepTransfersTopK(const std::vector<double>& initialRadii,
+                                               const std::vector<double>& finalRadii,
+                                               double mu, std::size_t k,
+                                               TransferMetric metric,
+                                               const std::vector<double>& initialEccentricities,
+                                               const std::vector<double>& finalEccentricities) {
+    const bool eccentric = checkSweepAxes(initialRadii, finalRadii,
+                                          initialEccentricities, finalEccentricities);
+    const std::size_t rows = initialRadii.size();
+    const std::size_t cols = finalRadii.size();
+
+    // Validate the axes once instead of every grid case
+    validateColumns(initialRadii.data(), initialRadii.data(),
+                    eccentric ? initialEccentricities.data() : nullptr,
+                    eccentric ? initialEccentricities.data() : nullptr, rows);
+    validateColumns(finalRadii.data(), finalRadii.data(),
+                    eccentric ? finalEccentricities.data() : nullptr,
+                    eccentric ? finalEccentricities.data() : nullptr, cols);
+
+    auto evaluate = [&](std::size_t i, std::size_t j, TransferResult& result) {
+        if (eccentric) {
+            return coaxialTransfer(initialRadii[i], initialEccentricities[i],
+                                   finalRadii[j], finalEccentricities[j], mu, result);
+        }
+        result = tangentTransfer(initialRadii[i], initialRadii[i], finalRadii[j], finalRadii[j], mu);
+        return TangentOption::PeriapsisToApoapsis;
+    };
+
+    TopKReducer best(k);
+    std::mutex bestMutex;
+    std::size_t rowGrain = std::max<std::size_t>(1, batchGrain / std::max<std::size_t>(1, cols));
+
+    TaskScheduler::global().parallelFor(0, rows, rowGrain, [&](std::size_t first, std::size_t last) {
+        TopKReducer local(k);
+        TransferResult result;
+        for (std::size_t i = first; i < last; ++i) {
+            for (std::size_t j = 0; j < cols; ++j) {
+                evaluate(i, j, result);
+                local.offer(metricValue(result, metric), i * cols + j);
+            }
+        }
+        std::lock_guard<std::mutex> lock(bestMutex);
+        best.merge(local);
+    });
+
+    std::vector<RankedTransfer> ranked;
+    for (const auto& entry : best.sorted()) {
+        RankedTransfer r;
+        r.index = entry.index;
+        r.option = evaluate(entry.index / cols, entry.index % cols, r.result);
+        ranked.push_back(r);
+    }
+    return ranked;
+}
+
+} // namespace hohmann